@@ -39,6 +39,8 @@ check_symbol_exists(elf_aux_info "sys/auxv.h" HAVE_ELF_AUX_INFO)
 check_symbol_exists(sysctlbyname "sys/types.h;sys/sysctl.h" HAVE_SYSCTLBYNAME)
 check_symbol_exists(CLOCK_MONOTONIC "time.h" HAVE_CLOCK_MONOTONIC)
 check_symbol_exists(clock_gettime "time.h" HAVE_CLOCK_GETTIME)
+check_symbol_exists(splice "fcntl.h" HAVE_SPLICE)
+check_symbol_exists(posix_fadvise "fcntl.h" HAVE_POSIX_FADVISE)
 
 check_c_source_compiles("
 #define _GNU_SOURCE
@@ -65,6 +67,15 @@ check_c_source_compiles("
 int main(int argc, char **argv) {
     setpgrp(0, 0);
 }" HAVE_BINARY_SETPGRP)
+check_c_source_compiles("
+#include <sys/types.h>
+#include <dirent.h>
+
+int main(int argc, char **argv) {
+    struct dirent de;
+    de.d_type = DT_REG;
+    return de.d_type == DT_UNKNOWN || de.d_type == DT_LNK;
+}" HAVE_DIRENT_D_TYPE)
 
 if(HAVE_GETADDRINFO AND PUTTY_IPV6)
   set(NO_IPV6 OFF)
@@ -275,6 +275,16 @@ CONF_OPTION(ssh_simple,
     DEFAULT_BOOL(false),
     NOT_SAVED,
 )
+CONF_OPTION(ssh_max_window,
+    /*
+     * Upper limit on how far we'll let an SSH-2 channel's receive
+     * window grow while auto-tuning it to the link's bandwidth-delay
+     * product.
+     */
+    VALUE_TYPE(STR), /* string encoding e.g. "100K", "2M", "1G" */
+    DEFAULT_STR("1G"),
+    SAVE_KEYWORD("SshMaxWindow"),
+)
 CONF_OPTION(ssh_connection_sharing,
     VALUE_TYPE(BOOL),
     DEFAULT_BOOL(false),
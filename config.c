@@ -2777,6 +2777,11 @@ void setup_config_box(struct controlbox *b, bool midsession,
                          conf_editbox_handler,
                          I(CONF_ssh_rekey_data),
                          ED_STR);
+            ctrl_editbox(s, "通道接收窗口上限(W)：", 'w', 20,
+                         HELPCTX(ssh_max_window),
+                         conf_editbox_handler,
+                         I(CONF_ssh_max_window),
+                         ED_STR);
             ctrl_text(s, "(使用 1M 表示 1 兆字节，1G 表示 1 吉字节)",
                       HELPCTX(ssh_kex_repeat));
         }
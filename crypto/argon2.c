@@ -98,8 +98,28 @@ strbuf *argon2_long_hash(unsigned length, ptrlen data)
  * a 1Kb output block. The first thing that happens to the input blocks is
  * that they get XORed together, and then only the XOR output is used, so you
  * could perfectly well regard G as a 1Kb->1Kb function.
+ *
+ * We keep every block of the main array as 128 64-bit words in native byte
+ * order, so that G never has to do any byte-by-byte marshalling. Conversion
+ * to and from the little-endian byte form defined by the spec happens only at
+ * the edges of the algorithm, i.e. when the initial blocks are generated by
+ * H' and when the final column is hashed to produce the output.
  */
 
+struct blk { uint64_t w[128]; };
+
+static void blk_from_bytes(struct blk *b, const uint8_t *data)
+{
+    for (unsigned i = 0; i < 128; i++)
+        b->w[i] = GET_64BIT_LSB_FIRST(data + 8*i);
+}
+
+static void blk_to_bytes(uint8_t *data, const struct blk *b)
+{
+    for (unsigned i = 0; i < 128; i++)
+        PUT_64BIT_LSB_FIRST(data + 8*i, b->w[i]);
+}
+
 static inline uint64_t ror(uint64_t x, unsigned rotation)
 {
     unsigned lshift = 63 & -rotation, rshift = 63 & rotation;
@@ -129,51 +149,46 @@ static inline void GB(uint64_t *a, uint64_t *b, uint64_t *c, uint64_t *d)
  * applied to different subsets of the 128 words in a kilobyte block, and the
  * API here is designed to make it easy to apply in the circumstances the spec
  * requires. In every call, the sixteen words form eight pairs adjacent in
- * memory, whose addresses are in arithmetic progression. So the 16 input
- * words are in[0], in[1], in[instep], in[instep+1], ..., in[7*instep],
- * in[7*instep+1], and the 16 output words similarly. */
-static inline void P(uint64_t *out, unsigned outstep,
-                     uint64_t *in, unsigned instep)
+ * memory, whose addresses are in arithmetic progression. So the 16 words are
+ * v[0], v[1], v[step], v[step+1], ..., v[7*step], v[7*step+1].
+ *
+ * P works in place: the words are overwritten with the mixed output. */
+static inline void P(uint64_t *v, unsigned step)
 {
-    for (unsigned i = 0; i < 8; i++) {
-        out[i*outstep] = in[i*instep];
-        out[i*outstep+1] = in[i*instep+1];
-    }
-
-    GB(out+0*outstep+0, out+2*outstep+0, out+4*outstep+0, out+6*outstep+0);
-    GB(out+0*outstep+1, out+2*outstep+1, out+4*outstep+1, out+6*outstep+1);
-    GB(out+1*outstep+0, out+3*outstep+0, out+5*outstep+0, out+7*outstep+0);
-    GB(out+1*outstep+1, out+3*outstep+1, out+5*outstep+1, out+7*outstep+1);
-
-    GB(out+0*outstep+0, out+2*outstep+1, out+5*outstep+0, out+7*outstep+1);
-    GB(out+0*outstep+1, out+3*outstep+0, out+5*outstep+1, out+6*outstep+0);
-    GB(out+1*outstep+0, out+3*outstep+1, out+4*outstep+0, out+6*outstep+1);
-    GB(out+1*outstep+1, out+2*outstep+0, out+4*outstep+1, out+7*outstep+0);
+    GB(v+0*step+0, v+2*step+0, v+4*step+0, v+6*step+0);
+    GB(v+0*step+1, v+2*step+1, v+4*step+1, v+6*step+1);
+    GB(v+1*step+0, v+3*step+0, v+5*step+0, v+7*step+0);
+    GB(v+1*step+1, v+3*step+1, v+5*step+1, v+7*step+1);
+
+    GB(v+0*step+0, v+2*step+1, v+5*step+0, v+7*step+1);
+    GB(v+0*step+1, v+3*step+0, v+5*step+1, v+6*step+0);
+    GB(v+1*step+0, v+3*step+1, v+4*step+0, v+6*step+1);
+    GB(v+1*step+1, v+2*step+0, v+4*step+1, v+7*step+0);
 }
 
 /* The full G function, taking input blocks X and Y. The result of G is most
  * often XORed into an existing output block, so this API is designed with
  * that in mind: the mixing function's output is always XORed into whatever
- * 1Kb of data is already at 'out'. */
-static void G_xor(uint8_t *out, const uint8_t *X, const uint8_t *Y)
+ * 1Kb of data is already at 'out'. It's safe for 'out' to alias X or Y. */
+static void G_xor(struct blk *out, const struct blk *X, const struct blk *Y)
 {
-    uint64_t R[128], Q[128], Z[128];
+    uint64_t R[128], Z[128];
 
     for (unsigned i = 0; i < 128; i++)
-        R[i] = GET_64BIT_LSB_FIRST(X + 8*i) ^ GET_64BIT_LSB_FIRST(Y + 8*i);
+        Z[i] = R[i] = X->w[i] ^ Y->w[i];
 
+    /* Mix each row of the 8x8 matrix of 16-byte registers, then each
+     * column, both in place in Z. */
     for (unsigned i = 0; i < 8; i++)
-        P(Q+16*i, 2, R+16*i, 2);
+        P(Z+16*i, 2);
 
     for (unsigned i = 0; i < 8; i++)
-        P(Z+2*i, 16, Q+2*i, 16);
+        P(Z+2*i, 16);
 
     for (unsigned i = 0; i < 128; i++)
-        PUT_64BIT_LSB_FIRST(out + 8*i,
-                            GET_64BIT_LSB_FIRST(out + 8*i) ^ R[i] ^ Z[i]);
+        out->w[i] ^= R[i] ^ Z[i];
 
     smemclr(R, sizeof(R));
-    smemclr(Q, sizeof(Q));
     smemclr(Z, sizeof(Z));
 }
 
@@ -181,6 +196,209 @@ static void G_xor(uint8_t *out, const uint8_t *X, const uint8_t *Y)
  * The main Argon2 function.
  */
 
+/* Parameters of a single Argon2 run that every segment computation needs. */
+struct argon2_state {
+    struct blk *B;
+    size_t p, q, SL, mprime;
+    uint32_t t, y;
+};
+
+/*
+ * Process one segment of the array: the blocks in lane i that fall within
+ * the given slice, on the given pass.
+ *
+ * The spec arranges that the segments making up a single slice never read
+ * from each other, so each call to this function depends only on the array
+ * state left behind by previous slices and on its own output. That makes a
+ * segment the natural unit of work; this function touches no state other
+ * than its own lane's blocks and its own local J1/J2 generator.
+ */
+static void argon2_fill_segment(const struct argon2_state *st, size_t pass,
+                                unsigned slice, size_t i, size_t jstart,
+                                bool d_mode)
+{
+    struct blk *B = st->B;
+    size_t p = st->p, q = st->q, SL = st->SL, mprime = st->mprime;
+    uint32_t t = st->t, y = st->y;
+    struct blk out2i, tmp2i, in2i;
+
+    /* Process the blocks of the segment from left to right,
+     * starting at 'jstart' (usually 0, but 2 in the first
+     * slice). */
+    for (size_t jpre = jstart; jpre < SL; jpre++) {
+
+        /* j is the x-coordinate of each block we process, made up
+         * of the slice number and the index 'jpre' within the
+         * segment. */
+        size_t j = slice * SL + jpre;
+
+        /* jm1 is j-1 (mod q) */
+        uint32_t jm1 = (j == 0 ? q-1 : j-1);
+
+        /*
+         * Construct two 32-bit pseudorandom integers J1 and J2.
+         * This is the part of the algorithm that varies between
+         * the data-dependent and independent modes.
+         */
+        uint32_t J1, J2;
+        if (d_mode) {
+            /*
+             * Data-dependent: grab the first 64 bits of the block
+             * to the left of this one.
+             */
+            J1 = trunc32(B[i + p * jm1].w[0]);
+            J2 = B[i + p * jm1].w[0] >> 32;
+        } else {
+            /*
+             * Data-independent: generate pseudorandom data by
+             * hashing a sequence of preimage blocks that include
+             * all our input parameters, plus the coordinates of
+             * this point in the algorithm (array position and
+             * pass number) to make all the hash outputs distinct.
+             *
+             * The hash we use is G itself, applied twice. So we
+             * generate 1Kb of data at a time, which is enough for
+             * 128 (J1,J2) pairs. Hence we only need to do the
+             * hashing if our index within the segment is a
+             * multiple of 128, or if we're at the very start of
+             * the algorithm (in which case we started at 2 rather
+             * than 0). After that we can just keep picking data
+             * out of our most recent hash output.
+             */
+            if (jpre == jstart || jpre % 128 == 0) {
+                /*
+                 * Hash preimage is mostly zeroes, with a
+                 * collection of assorted integer values we had
+                 * anyway.
+                 */
+                memset(&in2i, 0, sizeof(in2i));
+                in2i.w[0] = pass;
+                in2i.w[1] = i;
+                in2i.w[2] = slice;
+                in2i.w[3] = mprime;
+                in2i.w[4] = t;
+                in2i.w[5] = y;
+                in2i.w[6] = jpre / 128 + 1;
+
+                /*
+                 * Now apply G twice to generate the hash output
+                 * in out2i.
+                 */
+                memset(&tmp2i, 0, sizeof(tmp2i));
+                G_xor(&tmp2i, &tmp2i, &in2i);
+                memset(&out2i, 0, sizeof(out2i));
+                G_xor(&out2i, &out2i, &tmp2i);
+            }
+
+            /*
+             * Extract J1 and J2 from the most recent hash output
+             * (whether we've just computed it or not).
+             */
+            J1 = trunc32(out2i.w[jpre % 128]);
+            J2 = out2i.w[jpre % 128] >> 32;
+        }
+
+        /*
+         * Now convert J1 and J2 into the index of an existing
+         * block of the array to use as input to this step. This
+         * is fairly fiddly.
+         *
+         * The easy part: the y-coordinate of the input block is
+         * obtained by reducing J2 mod p, except that at the very
+         * start of the algorithm (processing the first slice on
+         * the first pass) we simply use the same y-coordinate as
+         * our output block.
+         *
+         * Note that it's safe to use the ordinary % operator
+         * here, without any concern for timing side channels: in
+         * data-independent mode J2 is not correlated to any
+         * secrets, and in data-dependent mode we're going to be
+         * giving away side-channel data _anyway_ when we use it
+         * as an array index (and by assumption we don't care,
+         * because it's already massively randomised from the real
+         * inputs).
+         */
+        uint32_t index_l = (pass == 0 && slice == 0) ? i : J2 % p;
+
+        /*
+         * The hard part: which block in this array row do we use?
+         *
+         * First, we decide what the possible candidates are. This
+         * requires some case analysis, and depends on whether the
+         * array row is the same one we're writing into or not.
+         *
+         * If it's not the same row: we can't use any block from
+         * the current slice (because the segments within a slice
+         * have to be processable in parallel, so in a concurrent
+         * implementation those blocks are potentially in the
+         * process of being overwritten by other threads). But the
+         * other three slices are fair game, except that in the
+         * first pass, slices to the right of us won't have had
+         * any values written into them yet at all.
+         *
+         * If it is the same row, we _are_ allowed to use blocks
+         * from the current slice, but only the ones before our
+         * current position.
+         *
+         * In both cases, we also exclude the individual _column_
+         * just to the left of the current one. (The block
+         * immediately to our left is going to be the _other_
+         * input to G, but the spec also says that we avoid that
+         * column even in a different row.)
+         *
+         * All of this means that we end up choosing from a
+         * cyclically contiguous interval of blocks within this
+         * lane, but the start and end points require some thought
+         * to get them right.
+         */
+
+        /* Start position is the beginning of the _next_ slice
+         * (containing data from the previous pass), unless we're
+         * on pass 0, where the start position has to be 0. */
+        uint32_t Wstart = (pass == 0 ? 0 : (slice + 1) % 4 * SL);
+
+        /* End position splits up by cases. */
+        uint32_t Wend;
+        if (index_l == i) {
+            /* Same lane as output: we can use anything up to (but
+             * not including) the block immediately left of us. */
+            Wend = jm1;
+        } else {
+            /* Different lane from output: we can use anything up
+             * to the previous slice boundary, or one less than
+             * that if we're at the very left edge of our slice
+             * right now. */
+            Wend = SL * slice;
+            if (jpre == 0)
+                Wend = (Wend + q-1) % q;
+        }
+
+        /* Total number of blocks available to choose from */
+        uint32_t Wsize = (Wend + q - Wstart) % q;
+
+        /* Fiddly computation from the spec that chooses from the
+         * available blocks, in a deliberately non-uniform
+         * fashion, using J1 as pseudorandom input data. Output is
+         * zz which is the index within our contiguous interval. */
+        uint32_t x = ((uint64_t)J1 * J1) >> 32;
+        uint32_t y = ((uint64_t)Wsize * x) >> 32;
+        uint32_t zz = Wsize - 1 - y;
+
+        /* And index_z is the actual x coordinate of the block we
+         * want. */
+        uint32_t index_z = (Wstart + zz) % q;
+
+        /* Phew! Combine that block with the one immediately to
+         * our left, and XOR over the top of whatever is already
+         * in our current output block. */
+        G_xor(&B[i + p * j], &B[i + p * jm1], &B[index_l + p * index_z]);
+    }
+
+    smemclr(&out2i, sizeof(out2i));
+    smemclr(&tmp2i, sizeof(tmp2i));
+    smemclr(&in2i, sizeof(in2i));
+}
+
 static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
                             uint32_t y, ptrlen P, ptrlen S, ptrlen K, ptrlen X,
                             uint8_t *out)
@@ -210,8 +428,6 @@ static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
         ssh_hash_final(h, h0);
     }
 
-    struct blk { uint8_t data[1024]; };
-
     /*
      * Array of 1Kb blocks. The total size is (approximately) m, the
      * caller-specified parameter for how much memory to use; the blocks are
@@ -242,19 +458,22 @@ static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
      * the long-output hash function H' to hash h0 itself plus the block's
      * coordinates in the array.
      */
+    uint8_t blkbytes[1024];
     for (size_t i = 0; i < p; i++) {
         ssh_hash *h = hprime_new(1024);
         put_data(h, h0, 64);
         put_uint32_le(h, 0);
         put_uint32_le(h, i);
-        hprime_final(h, 1024, B[i].data);
+        hprime_final(h, 1024, blkbytes);
+        blk_from_bytes(&B[i], blkbytes);
     }
     for (size_t i = 0; i < p; i++) {
         ssh_hash *h = hprime_new(1024);
         put_data(h, h0, 64);
         put_uint32_le(h, 1);
         put_uint32_le(h, i);
-        hprime_final(h, 1024, B[i+p].data);
+        hprime_final(h, 1024, blkbytes);
+        blk_from_bytes(&B[i+p], blkbytes);
     }
 
     /*
@@ -276,7 +495,9 @@ static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
      */
     size_t jstart = 2;
     bool d_mode = (y == 0);
-    struct blk out2i, tmp2i, in2i;
+    struct argon2_state st = {
+        .B = B, .p = p, .q = q, .SL = SL, .mprime = mprime, .t = t, .y = y,
+    };
 
     /* Outermost loop: t whole passes from left to right over the array */
     for (size_t pass = 0; pass < t; pass++) {
@@ -291,183 +512,8 @@ static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
 
             /* Loop over every segment in the slice (i.e. every row). So i is
              * the y-coordinate of each block we process. */
-            for (size_t i = 0; i < p; i++) {
-
-                /* And within that segment, process the blocks from left to
-                 * right, starting at 'jstart' (usually 0, but 2 in the first
-                 * slice). */
-                for (size_t jpre = jstart; jpre < SL; jpre++) {
-
-                    /* j is the x-coordinate of each block we process, made up
-                     * of the slice number and the index 'jpre' within the
-                     * segment. */
-                    size_t j = slice * SL + jpre;
-
-                    /* jm1 is j-1 (mod q) */
-                    uint32_t jm1 = (j == 0 ? q-1 : j-1);
-
-                    /*
-                     * Construct two 32-bit pseudorandom integers J1 and J2.
-                     * This is the part of the algorithm that varies between
-                     * the data-dependent and independent modes.
-                     */
-                    uint32_t J1, J2;
-                    if (d_mode) {
-                        /*
-                         * Data-dependent: grab the first 64 bits of the block
-                         * to the left of this one.
-                         */
-                        J1 = GET_32BIT_LSB_FIRST(B[i + p * jm1].data);
-                        J2 = GET_32BIT_LSB_FIRST(B[i + p * jm1].data + 4);
-                    } else {
-                        /*
-                         * Data-independent: generate pseudorandom data by
-                         * hashing a sequence of preimage blocks that include
-                         * all our input parameters, plus the coordinates of
-                         * this point in the algorithm (array position and
-                         * pass number) to make all the hash outputs distinct.
-                         *
-                         * The hash we use is G itself, applied twice. So we
-                         * generate 1Kb of data at a time, which is enough for
-                         * 128 (J1,J2) pairs. Hence we only need to do the
-                         * hashing if our index within the segment is a
-                         * multiple of 128, or if we're at the very start of
-                         * the algorithm (in which case we started at 2 rather
-                         * than 0). After that we can just keep picking data
-                         * out of our most recent hash output.
-                         */
-                        if (jpre == jstart || jpre % 128 == 0) {
-                            /*
-                             * Hash preimage is mostly zeroes, with a
-                             * collection of assorted integer values we had
-                             * anyway.
-                             */
-                            memset(in2i.data, 0, sizeof(in2i.data));
-                            PUT_64BIT_LSB_FIRST(in2i.data +  0, pass);
-                            PUT_64BIT_LSB_FIRST(in2i.data +  8, i);
-                            PUT_64BIT_LSB_FIRST(in2i.data + 16, slice);
-                            PUT_64BIT_LSB_FIRST(in2i.data + 24, mprime);
-                            PUT_64BIT_LSB_FIRST(in2i.data + 32, t);
-                            PUT_64BIT_LSB_FIRST(in2i.data + 40, y);
-                            PUT_64BIT_LSB_FIRST(in2i.data + 48, jpre / 128 + 1);
-
-                            /*
-                             * Now apply G twice to generate the hash output
-                             * in out2i.
-                             */
-                            memset(tmp2i.data, 0, sizeof(tmp2i.data));
-                            G_xor(tmp2i.data, tmp2i.data, in2i.data);
-                            memset(out2i.data, 0, sizeof(out2i.data));
-                            G_xor(out2i.data, out2i.data, tmp2i.data);
-                        }
-
-                        /*
-                         * Extract J1 and J2 from the most recent hash output
-                         * (whether we've just computed it or not).
-                         */
-                        J1 = GET_32BIT_LSB_FIRST(
-                            out2i.data + 8 * (jpre % 128));
-                        J2 = GET_32BIT_LSB_FIRST(
-                            out2i.data + 8 * (jpre % 128) + 4);
-                    }
-
-                    /*
-                     * Now convert J1 and J2 into the index of an existing
-                     * block of the array to use as input to this step. This
-                     * is fairly fiddly.
-                     *
-                     * The easy part: the y-coordinate of the input block is
-                     * obtained by reducing J2 mod p, except that at the very
-                     * start of the algorithm (processing the first slice on
-                     * the first pass) we simply use the same y-coordinate as
-                     * our output block.
-                     *
-                     * Note that it's safe to use the ordinary % operator
-                     * here, without any concern for timing side channels: in
-                     * data-independent mode J2 is not correlated to any
-                     * secrets, and in data-dependent mode we're going to be
-                     * giving away side-channel data _anyway_ when we use it
-                     * as an array index (and by assumption we don't care,
-                     * because it's already massively randomised from the real
-                     * inputs).
-                     */
-                    uint32_t index_l = (pass == 0 && slice == 0) ? i : J2 % p;
-
-                    /*
-                     * The hard part: which block in this array row do we use?
-                     *
-                     * First, we decide what the possible candidates are. This
-                     * requires some case analysis, and depends on whether the
-                     * array row is the same one we're writing into or not.
-                     *
-                     * If it's not the same row: we can't use any block from
-                     * the current slice (because the segments within a slice
-                     * have to be processable in parallel, so in a concurrent
-                     * implementation those blocks are potentially in the
-                     * process of being overwritten by other threads). But the
-                     * other three slices are fair game, except that in the
-                     * first pass, slices to the right of us won't have had
-                     * any values written into them yet at all.
-                     *
-                     * If it is the same row, we _are_ allowed to use blocks
-                     * from the current slice, but only the ones before our
-                     * current position.
-                     *
-                     * In both cases, we also exclude the individual _column_
-                     * just to the left of the current one. (The block
-                     * immediately to our left is going to be the _other_
-                     * input to G, but the spec also says that we avoid that
-                     * column even in a different row.)
-                     *
-                     * All of this means that we end up choosing from a
-                     * cyclically contiguous interval of blocks within this
-                     * lane, but the start and end points require some thought
-                     * to get them right.
-                     */
-
-                    /* Start position is the beginning of the _next_ slice
-                     * (containing data from the previous pass), unless we're
-                     * on pass 0, where the start position has to be 0. */
-                    uint32_t Wstart = (pass == 0 ? 0 : (slice + 1) % 4 * SL);
-
-                    /* End position splits up by cases. */
-                    uint32_t Wend;
-                    if (index_l == i) {
-                        /* Same lane as output: we can use anything up to (but
-                         * not including) the block immediately left of us. */
-                        Wend = jm1;
-                    } else {
-                        /* Different lane from output: we can use anything up
-                         * to the previous slice boundary, or one less than
-                         * that if we're at the very left edge of our slice
-                         * right now. */
-                        Wend = SL * slice;
-                        if (jpre == 0)
-                            Wend = (Wend + q-1) % q;
-                    }
-
-                    /* Total number of blocks available to choose from */
-                    uint32_t Wsize = (Wend + q - Wstart) % q;
-
-                    /* Fiddly computation from the spec that chooses from the
-                     * available blocks, in a deliberately non-uniform
-                     * fashion, using J1 as pseudorandom input data. Output is
-                     * zz which is the index within our contiguous interval. */
-                    uint32_t x = ((uint64_t)J1 * J1) >> 32;
-                    uint32_t y = ((uint64_t)Wsize * x) >> 32;
-                    uint32_t zz = Wsize - 1 - y;
-
-                    /* And index_z is the actual x coordinate of the block we
-                     * want. */
-                    uint32_t index_z = (Wstart + zz) % q;
-
-                    /* Phew! Combine that block with the one immediately to
-                     * our left, and XOR over the top of whatever is already
-                     * in our current output block. */
-                    G_xor(B[i + p * j].data, B[i + p * jm1].data,
-                          B[index_l + p * index_z].data);
-                }
-            }
+            for (size_t i = 0; i < p; i++)
+                argon2_fill_segment(&st, pass, slice, i, jstart, d_mode);
 
             /* We've finished processing a slice. Reset jstart to 0. It will
              * onily _not_ have been 0 if this was pass 0 slice 0, in which
@@ -486,21 +532,22 @@ static void argon2_internal(uint32_t p, uint32_t T, uint32_t m, uint32_t t,
 
     struct blk C = B[p * (q-1)];
     for (size_t i = 1; i < p; i++)
-        memxor(C.data, C.data, B[i + p * (q-1)].data, 1024);
+        for (unsigned k = 0; k < 128; k++)
+            C.w[k] ^= B[i + p * (q-1)].w[k];
 
     {
         ssh_hash *h = hprime_new(T);
-        put_data(h, C.data, 1024);
+        blk_to_bytes(blkbytes, &C);
+        put_data(h, blkbytes, 1024);
         hprime_final(h, T, out);
     }
 
     /*
      * Clean up.
      */
-    smemclr(out2i.data, sizeof(out2i.data));
-    smemclr(tmp2i.data, sizeof(tmp2i.data));
-    smemclr(in2i.data, sizeof(in2i.data));
-    smemclr(C.data, sizeof(C.data));
+    smemclr(blkbytes, sizeof(blkbytes));
+    smemclr(&C, sizeof(C));
+    smemclr(h0, sizeof(h0));
     smemclr(B, mprime * sizeof(struct blk));
     sfree(B);
 }
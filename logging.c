@@ -20,12 +20,83 @@ struct LogContext {
     LogPolicy *lp;
     Conf *conf;
     int logtype;                       /* cached out of conf */
+
+    /*
+     * Data destined for an open log file is accumulated here, and
+     * handed to stdio in one go when the buffer fills up, on
+     * logflush(), from a toplevel callback once the current burst of
+     * output is over, when the log is closed, or at exit (see
+     * log_atexit below). That saves a great deal of overhead when
+     * logtraffic() is called once per character.
+     */
+    strbuf *pending;
+    IdempotentCallback ic_flush;
+
+    /* List of all LogContexts, so they can be flushed at exit */
+    LogContext *next, *prev;
 };
 
+#define LOG_BUFFER_SIZE 65536
+
+static LogContext *all_logctxs;
+
 static Filename *xlatlognam(const Filename *s,
                             const char *hostname, int port,
                             const struct tm *tm);
 
+/*
+ * Write out the contents of ctx->pending.
+ */
+static void log_write_pending(LogContext *ctx)
+{
+    if (!ctx->pending->len)
+        return;
+
+    assert(ctx->state == L_OPEN);
+    assert(ctx->lgfp);
+    size_t len = ctx->pending->len;
+    size_t written = fwrite(ctx->pending->u, 1, len, ctx->lgfp);
+    strbuf_clear(ctx->pending);
+    if (written < len) {
+        logfclose(ctx);
+        ctx->state = L_ERROR;
+        lp_eventlog(ctx->lp, "Disabled writing session log "
+                    "due to error while writing");
+    }
+}
+
+static void log_flush_callback(void *vctx)
+{
+    LogContext *ctx = (LogContext *)vctx;
+    if (ctx->state == L_OPEN)
+        log_write_pending(ctx);
+}
+
+/*
+ * Many tools leave via cleanup_exit() or a fatal-error handler
+ * without ever calling log_free, relying on exit() to flush stdio.
+ * Our own buffer needs the same treatment, so on the first log_init
+ * we register this to hand all pending data to stdio, which exit()
+ * then flushes as usual.
+ */
+static void log_atexit(void)
+{
+    for (LogContext *ctx = all_logctxs; ctx; ctx = ctx->next)
+        if (ctx->state == L_OPEN)
+            log_write_pending(ctx);
+}
+
+/*
+ * Called after appending to ctx->pending.
+ */
+static inline void log_pending_added(LogContext *ctx)
+{
+    if (ctx->pending->len >= LOG_BUFFER_SIZE)
+        log_write_pending(ctx);
+    else
+        queue_idempotent_callback(&ctx->ic_flush);
+}
+
 /*
  * Internal wrapper function which must be called for _all_ output
  * to the log file. It takes care of opening the log file if it
@@ -45,13 +116,8 @@ static void logwrite(LogContext *ctx, ptrlen data)
     if (ctx->state == L_OPENING) {
         bufchain_add(&ctx->queue, data.ptr, data.len);
     } else if (ctx->state == L_OPEN) {
-        assert(ctx->lgfp);
-        if (fwrite(data.ptr, 1, data.len, ctx->lgfp) < data.len) {
-            logfclose(ctx);
-            ctx->state = L_ERROR;
-            lp_eventlog(ctx->lp, "Disabled writing session log "
-                        "due to error while writing");
-        }
+        put_datapl(ctx->pending, data);
+        log_pending_added(ctx);
     }                                  /* else L_ERROR, so ignore the write */
 }
 
@@ -62,14 +128,18 @@ static void logwrite(LogContext *ctx, ptrlen data)
 static PRINTF_LIKE(2, 3) void logprintf(LogContext *ctx, const char *fmt, ...)
 {
     va_list ap;
-    char *data;
 
     va_start(ap, fmt);
-    data = dupvprintf(fmt, ap);
+    if (ctx->state == L_OPEN) {
+        /* Common case: format straight into the output buffer */
+        put_fmtv(ctx->pending, fmt, ap);
+        log_pending_added(ctx);
+    } else {
+        char *data = dupvprintf(fmt, ap);
+        logwrite(ctx, ptrlen_from_asciz(data));
+        sfree(data);
+    }
     va_end(ap);
-
-    logwrite(ctx, ptrlen_from_asciz(data));
-    sfree(data);
 }
 
 /*
@@ -78,8 +148,11 @@ static PRINTF_LIKE(2, 3) void logprintf(LogContext *ctx, const char *fmt, ...)
 void logflush(LogContext *ctx)
 {
     if (ctx->logtype > 0)
-        if (ctx->state == L_OPEN)
-            fflush(ctx->lgfp);
+        if (ctx->state == L_OPEN) {
+            log_write_pending(ctx);
+            if (ctx->state == L_OPEN)
+                fflush(ctx->lgfp);
+        }
 }
 
 LogPolicy *log_get_policy(LogContext *ctx)
@@ -196,9 +269,13 @@ void logfopen(LogContext *ctx)
 void logfclose(LogContext *ctx)
 {
     if (ctx->lgfp) {
+        /* We're closing the file anyway, so don't fuss about errors */
+        if (ctx->pending->len)
+            fwrite(ctx->pending->u, 1, ctx->pending->len, ctx->lgfp);
         fclose(ctx->lgfp);
         ctx->lgfp = NULL;
     }
+    strbuf_clear(ctx->pending);
     ctx->state = L_CLOSED;
 }
 
@@ -208,8 +285,14 @@ void logfclose(LogContext *ctx)
 void logtraffic(LogContext *ctx, unsigned char c, int logmode)
 {
     if (ctx->logtype > 0) {
-        if (ctx->logtype == logmode)
-            logwrite(ctx, make_ptrlen(&c, 1));
+        if (ctx->logtype == logmode) {
+            if (ctx->state == L_OPEN) {
+                put_byte(ctx->pending, c);
+                log_pending_added(ctx);
+            } else {
+                logwrite(ctx, make_ptrlen(&c, 1));
+            }
+        }
     }
 }
 
@@ -389,12 +472,36 @@ LogContext *log_init(LogPolicy *lp, Conf *conf)
     ctx->logtype = conf_get_int(ctx->conf, CONF_logtype);
     ctx->currlogfilename = NULL;
     bufchain_init(&ctx->queue);
+    ctx->pending = strbuf_new();
+    ctx->ic_flush.fn = log_flush_callback;
+    ctx->ic_flush.ctx = ctx;
+    ctx->ic_flush.queued = false;
+
+    static bool atexit_registered = false;
+    if (!atexit_registered) {
+        atexit(log_atexit);
+        atexit_registered = true;
+    }
+    ctx->prev = NULL;
+    ctx->next = all_logctxs;
+    if (ctx->next)
+        ctx->next->prev = ctx;
+    all_logctxs = ctx;
+
     return ctx;
 }
 
 void log_free(LogContext *ctx)
 {
     logfclose(ctx);
+    strbuf_free(ctx->pending);
+    delete_callbacks_for_context(ctx);
+    if (ctx->prev)
+        ctx->prev->next = ctx->next;
+    else
+        all_logctxs = ctx->next;
+    if (ctx->next)
+        ctx->next->prev = ctx->prev;
     bufchain_clear(&ctx->queue);
     if (ctx->currlogfilename)
         filename_free(ctx->currlogfilename);
@@ -142,6 +142,7 @@ void bufchain_clear(bufchain *ch);
 size_t bufchain_size(bufchain *ch);
 void bufchain_add(bufchain *ch, const void *data, size_t len);
 ptrlen bufchain_prefix(bufchain *ch);
+size_t bufchain_prefixes(bufchain *ch, ptrlen *out, size_t maxn);
 void bufchain_consume(bufchain *ch, size_t len);
 void bufchain_fetch(bufchain *ch, void *data, size_t len);
 void bufchain_fetch_consume(bufchain *ch, void *data, size_t len);
@@ -286,6 +287,16 @@ typedef enum DecodeUTF8Failure {
 unsigned decode_utf8(BinarySource *src, DecodeUTF8Failure *err);
 extern const char *const decode_utf8_error_strings[DUTF8_N_FAILURE_CODES];
 
+/* Decode as many complete, valid UTF-8 characters as possible from
+ * the start of a buffer, up to 'outlen' of them, writing their code
+ * points to 'out' and advancing *input and *inlen past them. Stops
+ * early at anything invalid or incomplete, and also at U+FFFE and
+ * U+FFFF, so that the caller can deal with that using whatever
+ * single-character decoder it would otherwise have used. Returns the
+ * number of code points written. */
+size_t decode_utf8_run(const char **input, size_t *inlen,
+                       unsigned *out, size_t outlen);
+
 /* Decode a single UTF-8 character to an output buffer of the
  * platform's wchar_t. May write a pair of surrogates if
  * sizeof(wchar_t) == 2, assuming that in that case the wide string is
@@ -294,6 +305,21 @@ extern const char *const decode_utf8_error_strings[DUTF8_N_FAILURE_CODES];
 size_t decode_utf8_to_wchar(BinarySource *src, wchar_t *out,
                             DecodeUTF8Failure *err);
 
+/*
+ * Properties of a Unicode character needed by the terminal and by
+ * normalisation, all found by unicode_props() in a single table probe.
+ * 'bidi' is a BidiType (see terminal/bidi.h) and 'cclass' is the
+ * canonical combining class.
+ */
+typedef struct UnicodeProps {
+    unsigned char flags, bidi, cclass;
+} UnicodeProps;
+#define UPROP_NONSPACING 0x01   /* occupies no character cells */
+#define UPROP_WIDE       0x02   /* East Asian Wide or Fullwidth */
+#define UPROP_AMBIGUOUS  0x04   /* East Asian Ambiguous width */
+#define UPROP_MIRRORED   0x08   /* has a mirror-image glyph in bidi */
+const UnicodeProps *unicode_props(unsigned c);
+
 /* Normalise a UTF-8 string into Normalisation Form C. */
 strbuf *utf8_to_nfc(ptrlen input);
 
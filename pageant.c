@@ -181,9 +181,37 @@ struct PageantPublicKey {
     strbuf *base_pub;            /* the true owner of sort.priv.base_pub */
     strbuf *full_pub;            /* the true owner of sort.full_pub */
     char *comment;
+    char *fingerprint;           /* for logging; computed on first use */
 };
 static tree234 *pubkeytree;
 
+/*
+ * Clients that make a lot of signature requests almost always ask
+ * for the same key over and over again (e.g. a build machine running
+ * many git-over-SSH connections with a single forwarded key). So we
+ * remember which key the last sign request used, which lets us skip
+ * the tree lookups - and, for a certified key, re-parsing the whole
+ * certificate to find the sort key - whenever the next request is for
+ * the same one. Reset whenever that public key is removed.
+ */
+static struct {
+    PageantPublicKey *pub;
+    PageantPrivateKey *priv;
+} last_signing_key;
+
+/*
+ * Running totals of SSH-2 signature requests, for the event log.
+ * Latency is measured from receiving the request to sending the
+ * response, so it includes any time spent waiting for a passphrase.
+ * The totals are logged after every SIGN_STATS_LOG_INTERVAL timed
+ * requests, rather than alongside each one.
+ */
+#define SIGN_STATS_LOG_INTERVAL 64
+static struct {
+    unsigned long requests, signatures, failures;
+    uint64_t timed, total_ticks, max_ticks;
+} sign_stats;
+
 typedef struct PageantSignOp PageantSignOp;
 struct PageantSignOp {
     PageantPrivateKey *priv;
@@ -191,6 +219,7 @@ struct PageantSignOp {
     unsigned flags;
     int crLine;
     unsigned char failure_type;
+    unsigned long start_time;
 
     PageantKeyRequestNode pkr;
     PageantAsyncOp pao;
@@ -232,6 +261,7 @@ static void pk_pub_free(PageantPublicKey *pub)
     if (pub->full_pub)
         strbuf_free(pub->full_pub);
     sfree(pub->comment);
+    sfree(pub->fingerprint);
     sfree(pub);
 }
 
@@ -322,6 +352,35 @@ static PageantPublicKey *findpubkey2(ptrlen full_pub)
     return toret;
 }
 
+/*
+ * Find the key to use for an SSH-2 sign request, checking first
+ * whether it's the same one as last time.
+ */
+static PageantPublicKey *findsigningkey2(ptrlen full_pub,
+                                         PageantPrivateKey **priv_out)
+{
+    PageantPublicKey *pub = last_signing_key.pub;
+    if (pub && ptrlen_eq_ptrlen(pub->sort.full_pub, full_pub)) {
+        *priv_out = last_signing_key.priv;
+        return pub;
+    }
+
+    pub = findpubkey2(full_pub);
+    if (pub) {
+        last_signing_key.pub = pub;
+        last_signing_key.priv = *priv_out = pub_to_priv(pub);
+    }
+    return pub;
+}
+
+static const char *pubkey_fingerprint(PageantPublicKey *pub)
+{
+    if (!pub->fingerprint)
+        pub->fingerprint = ssh2_double_fingerprint_blob(
+            pub->sort.full_pub, SSH_FPTYPE_DEFAULT);
+    return pub->fingerprint;
+}
+
 static int find_first_pubkey_for_version(int ssh_version)
 {
     PageantPublicKeySort sort;
@@ -481,6 +540,11 @@ static void remove_pubkey_cleanup(PageantPublicKey *pub)
      * public key sharing a private half, and if so, remove the
      * corresponding private entry too. */
 
+    if (pub == last_signing_key.pub) {
+        last_signing_key.pub = NULL;
+        last_signing_key.priv = NULL;
+    }
+
     PageantPublicKeySort pubsearch;
     pubsearch.priv = pub->sort.priv;
     pubsearch.full_pub = PTRLEN_LITERAL("");
@@ -653,6 +717,35 @@ static void signop_free(PageantAsyncOp *pao)
     sfree(so);
 }
 
+static void signop_record_outcome(PageantSignOp *so, bool success)
+{
+    uint64_t elapsed = (unsigned long)(GETTICKCOUNT() - so->start_time);
+
+    if (success)
+        sign_stats.signatures++;
+    else
+        sign_stats.failures++;
+    sign_stats.timed++;
+    sign_stats.total_ticks += elapsed;
+    if (sign_stats.max_ticks < elapsed)
+        sign_stats.max_ticks = elapsed;
+
+    PageantClient *pc = so->pao.info->pc;
+    if (!pc->suppress_logging) {
+        pageant_client_log(pc, so->pao.reqid,
+                           "sign request took %"PRIu64" ms",
+                           elapsed * 1000 / TICKSPERSEC);
+        if (sign_stats.timed % SIGN_STATS_LOG_INTERVAL == 0)
+            pageant_client_log(
+                pc, so->pao.reqid, "sign request totals: %lu requests, "
+                "%lu signed, %lu failed, mean %"PRIu64" ms, "
+                "max %"PRIu64" ms", sign_stats.requests,
+                sign_stats.signatures, sign_stats.failures,
+                sign_stats.total_ticks * 1000 / TICKSPERSEC /
+                sign_stats.timed, sign_stats.max_ticks * 1000 / TICKSPERSEC);
+    }
+}
+
 static bool request_passphrase(PageantClient *pc, PageantPrivateKey *priv)
 {
     if (!priv->decryption_prompt_active) {
@@ -729,8 +822,11 @@ static void signop_coroutine(PageantAsyncOp *pao)
     response = strbuf_new();
     put_byte(response, SSH2_AGENT_SIGN_RESPONSE);
     put_stringsb(response, signature);
+    pageant_client_log(so->pao.info->pc, so->pao.reqid,
+                       "reply: SSH2_AGENT_SIGN_RESPONSE");
 
   respond:
+    signop_record_outcome(so, response->u[0] == SSH2_AGENT_SIGN_RESPONSE);
     pageant_client_got_response(so->pao.info->pc, so->pao.reqid,
                                 ptrlen_from_strbuf(response));
     strbuf_free(response);
@@ -753,6 +849,7 @@ static void fail_requests_for_key(PageantPrivateKey *priv, const char *reason)
         strbuf *sb = strbuf_new();
         failure(so->pao.info->pc, so->pao.reqid, sb, so->failure_type,
                 "%s", reason);
+        signop_record_outcome(so, false);
         pageant_client_got_response(so->pao.info->pc, so->pao.reqid,
                                     ptrlen_from_strbuf(sb));
         strbuf_free(sb);
@@ -1067,15 +1164,19 @@ static PageantAsyncOp *pageant_make_op(
          * or not.
          */
         PageantPublicKey *pub;
+        PageantPrivateKey *priv;
         ptrlen keyblob, sigdata;
         uint32_t flags;
+        unsigned long start_time = GETTICKCOUNT();
 
         pageant_client_log(pc, reqid, "request: SSH2_AGENTC_SIGN_REQUEST");
+        sign_stats.requests++;
 
         keyblob = get_string(msg);
         sigdata = get_string(msg);
 
         if (get_err(msg)) {
+            sign_stats.failures++;
             fail("unable to decode request");
             goto responded;
         }
@@ -1093,13 +1194,21 @@ static PageantAsyncOp *pageant_make_op(
         if (!get_err(msg))
             have_flags = true;
 
+        pub = findsigningkey2(keyblob, &priv);
         if (!pc->suppress_logging) {
-            char *fingerprint = ssh2_double_fingerprint_blob(
-                keyblob, SSH_FPTYPE_DEFAULT);
-            pageant_client_log(pc, reqid, "requested key: %s", fingerprint);
-            sfree(fingerprint);
+            if (pub) {
+                pageant_client_log(pc, reqid, "requested key: %s",
+                                   pubkey_fingerprint(pub));
+            } else {
+                char *fingerprint = ssh2_double_fingerprint_blob(
+                    keyblob, SSH_FPTYPE_DEFAULT);
+                pageant_client_log(pc, reqid, "requested key: %s",
+                                   fingerprint);
+                sfree(fingerprint);
+            }
         }
-        if ((pub = findpubkey2(keyblob)) == NULL) {
+        if (!pub) {
+            sign_stats.failures++;
             fail("key not found");
             goto responded;
         }
@@ -1119,12 +1228,13 @@ static PageantAsyncOp *pageant_make_op(
         so->pao.cr.next = &pc->info->head;
         so->pao.cr.prev->next = so->pao.cr.next->prev = &so->pao.cr;
         so->pao.reqid = reqid;
-        so->priv = pub_to_priv(pub);
+        so->priv = priv;
         so->pkr.prev = so->pkr.next = NULL;
         so->data_to_sign = strbuf_dup(sigdata);
         so->flags = flags;
         so->failure_type = failure_type;
         so->crLine = 0;
+        so->start_time = start_time;
         return &so->pao;
         break;
       }
@@ -661,12 +661,10 @@ void scp_sftp_listdir(const char *dirname)
     } else {
         struct list_directory_from_sftp_ctx *ctx =
             list_directory_from_sftp_new();
+        struct fxp_dirread *dr = dirread_init(dirh);
 
         while (1) {
-
-            req = fxp_readdir_send(dirh);
-            pktin = sftp_wait_for_reply(req);
-            names = fxp_readdir_recv(pktin, req);
+            names = dirread_next(dr);
 
             if (names == NULL) {
                 if (fxp_error_type() == SSH_FX_EOF)
@@ -674,16 +672,13 @@ void scp_sftp_listdir(const char *dirname)
                 printf("Reading directory %s: %s\n", dirname, fxp_error());
                 break;
             }
-            if (names->nnames == 0) {
-                fxp_free_names(names);
-                break;
-            }
 
             for (size_t i = 0; i < names->nnames; i++)
                 list_directory_from_sftp_feed(ctx, &names->names[i]);
 
             fxp_free_names(names);
         }
+        dirread_cleanup(dr);
         req = fxp_close_send(dirh);
         pktin = sftp_wait_for_reply(req);
         fxp_close_recv(pktin, req);
@@ -1134,6 +1129,7 @@ int scp_get_sink_action(struct scp_sink_action *act)
         struct fxp_attrs attrs;
         struct sftp_packet *pktin;
         struct sftp_request *req;
+        const struct fxp_attrs *knownattrs = NULL;
         bool ret;
 
         if (!scp_sftp_dirstack_head) {
@@ -1166,6 +1162,7 @@ int scp_get_sink_action(struct scp_sink_action *act)
                 head->namepos++;       /* skip . and .. */
             if (head->namepos < head->namelen) {
                 head->matched_something = true;
+                knownattrs = &head->names[head->namepos].attrs;
                 fname = dupcat(head->dirpath, "/",
                                head->names[head->namepos++].filename);
                 must_free_fname = true;
@@ -1199,11 +1196,17 @@ int scp_get_sink_action(struct scp_sink_action *act)
 
         /*
          * Now we have a filename. Stat it, and see if it's a file
-         * or a directory.
+         * or a directory. If it came from a directory listing, we
+         * may already know.
          */
-        req = fxp_stat_send(fname);
-        pktin = sftp_wait_for_reply(req);
-        ret = fxp_stat_recv(pktin, req, &attrs);
+        if (knownattrs && fxp_readdir_attrs_usable(knownattrs)) {
+            attrs = *knownattrs;
+            ret = true;
+        } else {
+            req = fxp_stat_send(fname);
+            pktin = sftp_wait_for_reply(req);
+            ret = fxp_stat_recv(pktin, req, &attrs);
+        }
 
         if (!ret || !(attrs.flags & SSH_FILEXFER_ATTR_PERMISSIONS)) {
             with_stripctrl(san, fname)
@@ -1220,6 +1223,7 @@ int scp_get_sink_action(struct scp_sink_action *act)
             size_t nnames, namesize;
             struct fxp_name *ournames;
             struct fxp_names *names;
+            struct fxp_dirread *dr;
 
             /*
              * It's a directory. If we're not in recursive mode,
@@ -1273,12 +1277,11 @@ int scp_get_sink_action(struct scp_sink_action *act)
             }
             nnames = namesize = 0;
             ournames = NULL;
+            dr = dirread_init(dirhandle);
             while (1) {
                 int i;
 
-                req = fxp_readdir_send(dirhandle);
-                pktin = sftp_wait_for_reply(req);
-                names = fxp_readdir_recv(pktin, req);
+                names = dirread_next(dr);
 
                 if (names == NULL) {
                     if (fxp_error_type() == SSH_FX_EOF)
@@ -1287,6 +1290,7 @@ int scp_get_sink_action(struct scp_sink_action *act)
                         tell_user(stderr, "pscp: reading directory %s: %s",
                                   san, fxp_error());
 
+                    dirread_cleanup(dr);
                     req = fxp_close_send(dirhandle);
                     pktin = sftp_wait_for_reply(req);
                     fxp_close_recv(pktin, req);
@@ -1296,10 +1300,6 @@ int scp_get_sink_action(struct scp_sink_action *act)
                     errs++;
                     return 1;
                 }
-                if (names->nnames == 0) {
-                    fxp_free_names(names);
-                    break;
-                }
                 sgrowarrayn(ournames, namesize, nnames, names->nnames);
                 for (i = 0; i < names->nnames; i++) {
                     if (!strcmp(names->names[i].filename, ".") ||
@@ -1319,6 +1319,7 @@ int scp_get_sink_action(struct scp_sink_action *act)
                 names->nnames = 0;             /* prevent free_names */
                 fxp_free_names(names);
             }
+            dirread_cleanup(dr);
             req = fxp_close_send(dirhandle);
             pktin = sftp_wait_for_reply(req);
             fxp_close_recv(pktin, req);
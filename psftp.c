@@ -234,7 +234,13 @@ static void not_connected(void)
 /* ----------------------------------------------------------------------
  * The meat of the `get' and `put' commands.
  */
-bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
+/*
+ * If 'knownattrs' is not NULL, it's the attributes of the file as
+ * returned in a directory listing, which we can use instead of asking
+ * for them again if fxp_readdir_attrs_usable() says they'll do.
+ */
+bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart,
+                   const struct fxp_attrs *knownattrs)
 {
     struct fxp_handle *fh;
     struct sftp_packet *pktin;
@@ -244,6 +250,12 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
     WFile *file;
     bool toret, shown_err = false;
     struct fxp_attrs attrs;
+    bool got_attrs = false;
+
+    if (knownattrs && fxp_readdir_attrs_usable(knownattrs)) {
+        attrs = *knownattrs;
+        got_attrs = true;
+    }
 
     /*
      * In recursive mode, see if we're dealing with a directory.
@@ -253,9 +265,13 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
     if (recurse) {
         bool result;
 
-        req = fxp_stat_send(fname);
-        pktin = sftp_wait_for_reply(req);
-        result = fxp_stat_recv(pktin, req, &attrs);
+        if (got_attrs) {
+            result = true;
+        } else {
+            req = fxp_stat_send(fname);
+            pktin = sftp_wait_for_reply(req);
+            result = got_attrs = fxp_stat_recv(pktin, req, &attrs);
+        }
 
         if (result &&
             (attrs.flags & SSH_FILEXFER_ATTR_PERMISSIONS) &&
@@ -265,6 +281,7 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
             size_t nnames, namesize;
             struct fxp_name **ournames;
             struct fxp_names *names;
+            struct fxp_dirread *dr;
             int i;
 
             /*
@@ -294,12 +311,11 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
             }
             nnames = namesize = 0;
             ournames = NULL;
+            dr = dirread_init(dirhandle);
             while (1) {
                 int i;
 
-                req = fxp_readdir_send(dirhandle);
-                pktin = sftp_wait_for_reply(req);
-                names = fxp_readdir_recv(pktin, req);
+                names = dirread_next(dr);
 
                 if (names == NULL) {
                     if (fxp_error_type() == SSH_FX_EOF)
@@ -308,17 +324,16 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
                         printf("%s: reading directory: %s\n",
                                san, fxp_error());
 
+                    dirread_cleanup(dr);
                     req = fxp_close_send(dirhandle);
                     pktin = sftp_wait_for_reply(req);
                     fxp_close_recv(pktin, req);
 
+                    for (i = 0; i < nnames; i++)
+                        fxp_free_name(ournames[i]);
                     sfree(ournames);
                     return false;
                 }
-                if (names->nnames == 0) {
-                    fxp_free_names(names);
-                    break;
-                }
                 sgrowarrayn(ournames, namesize, nnames, names->nnames);
                 for (i = 0; i < names->nnames; i++)
                     if (strcmp(names->names[i].filename, ".") &&
@@ -334,6 +349,7 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
                     }
                 fxp_free_names(names);
             }
+            dirread_cleanup(dr);
             req = fxp_close_send(dirhandle);
             pktin = sftp_wait_for_reply(req);
             fxp_close_recv(pktin, req);
@@ -387,7 +403,8 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
                 nextfname = dupcat(fname, "/", ournames[i]->filename);
                 nextoutfname = dir_file_cat(outfname, ournames[i]->filename);
                 retd = sftp_get_file(
-                    nextfname, nextoutfname, recurse, restart);
+                    nextfname, nextoutfname, recurse, restart,
+                    &ournames[i]->attrs);
                 restart = false;       /* after first partial file, do full */
                 sfree(nextoutfname);
                 sfree(nextfname);
@@ -412,10 +429,12 @@ bool sftp_get_file(char *fname, char *outfname, bool recurse, bool restart)
         }
     }
 
-    req = fxp_stat_send(fname);
-    pktin = sftp_wait_for_reply(req);
-    if (!fxp_stat_recv(pktin, req, &attrs))
-        attrs.flags = 0;
+    if (!got_attrs) {
+        req = fxp_stat_send(fname);
+        pktin = sftp_wait_for_reply(req);
+        if (!fxp_stat_recv(pktin, req, &attrs))
+            attrs.flags = 0;
+    }
 
     req = fxp_open_send(fname, SSH_FXF_READ, NULL);
     pktin = sftp_wait_for_reply(req);
@@ -778,11 +797,16 @@ bool sftp_put_file(char *fname, char *outfname, bool recurse, bool restart)
  * local one in psftp.h.
  */
 
+/*
+ * The wildcard matcher reads the whole directory up front, keeping the
+ * names that match. Its callers send requests of their own in between
+ * fetching names from it, so it can't leave any FXP_READDIRs in
+ * flight between calls.
+ */
 typedef struct SftpWildcardMatcher {
-    struct fxp_handle *dirh;
-    struct fxp_names *names;
-    int namepos;
-    char *wildcard, *prefix;
+    char **names;
+    size_t nnames, namesize, namepos;
+    char *prefix;
 } SftpWildcardMatcher;
 
 SftpWildcardMatcher *sftp_begin_wildcard_matching(char *name)
@@ -825,11 +849,46 @@ SftpWildcardMatcher *sftp_begin_wildcard_matching(char *name)
     dirh = fxp_opendir_recv(pktin, req);
 
     if (dirh) {
+        struct fxp_dirread *dr = dirread_init(dirh);
+        struct fxp_names *names;
+
         swcm = snew(SftpWildcardMatcher);
-        swcm->dirh = dirh;
         swcm->names = NULL;
-        swcm->wildcard = dupstr(wildcard);
+        swcm->nnames = swcm->namesize = swcm->namepos = 0;
         swcm->prefix = unwcdir;
+
+        while ((names = dirread_next(dr)) != NULL) {
+            for (size_t i = 0; i < names->nnames; i++) {
+                struct fxp_name *name = &names->names[i];
+
+                if (!strcmp(name->filename, ".") ||
+                    !strcmp(name->filename, ".."))
+                    continue;          /* expected bad filenames */
+
+                if (!vet_filename(name->filename)) {
+                    with_stripctrl(san, name->filename)
+                        printf("ignoring potentially dangerous server-"
+                               "supplied filename '%s'\n", san);
+                    continue;          /* unexpected bad filename */
+                }
+
+                if (!wc_match(wildcard, name->filename))
+                    continue;          /* doesn't match the wildcard */
+
+                sgrowarray(swcm->names, swcm->namesize, swcm->nnames);
+                swcm->names[swcm->nnames++] = dupstr(name->filename);
+            }
+            fxp_free_names(names);
+        }
+        if (fxp_error_type() != SSH_FX_EOF) {
+            with_stripctrl(san, swcm->prefix)
+                printf("%s: reading directory: %s\n", san, fxp_error());
+        }
+
+        dirread_cleanup(dr);
+        req = fxp_close_send(dirh);
+        pktin = sftp_wait_for_reply(req);
+        fxp_close_recv(pktin, req);
     } else {
         printf("Unable to open %s: %s\n", cdir, fxp_error());
         swcm = NULL;
@@ -843,85 +902,25 @@ SftpWildcardMatcher *sftp_begin_wildcard_matching(char *name)
 
 char *sftp_wildcard_get_filename(SftpWildcardMatcher *swcm)
 {
-    struct fxp_name *name;
-    struct sftp_packet *pktin;
-    struct sftp_request *req;
-
-    while (1) {
-        if (swcm->names && swcm->namepos >= swcm->names->nnames) {
-            fxp_free_names(swcm->names);
-            swcm->names = NULL;
-        }
-
-        if (!swcm->names) {
-            req = fxp_readdir_send(swcm->dirh);
-            pktin = sftp_wait_for_reply(req);
-            swcm->names = fxp_readdir_recv(pktin, req);
-
-            if (!swcm->names) {
-                if (fxp_error_type() != SSH_FX_EOF) {
-                    with_stripctrl(san, swcm->prefix)
-                        printf("%s: reading directory: %s\n",
-                               san, fxp_error());
-                }
-                return NULL;
-            } else if (swcm->names->nnames == 0) {
-                /*
-                 * Another failure mode which we treat as EOF is if
-                 * the server reports success from FXP_READDIR but
-                 * returns no actual names. This is unusual, since
-                 * from most servers you'd expect at least "." and
-                 * "..", but there's nothing forbidding a server from
-                 * omitting those if it wants to.
-                 */
-                return NULL;
-            }
-
-            swcm->namepos = 0;
-        }
-
-        assert(swcm->names && swcm->namepos < swcm->names->nnames);
-
-        name = &swcm->names->names[swcm->namepos++];
-
-        if (!strcmp(name->filename, ".") || !strcmp(name->filename, ".."))
-            continue;                  /* expected bad filenames */
-
-        if (!vet_filename(name->filename)) {
-            with_stripctrl(san, name->filename)
-                printf("ignoring potentially dangerous server-"
-                       "supplied filename '%s'\n", san);
-            continue;                  /* unexpected bad filename */
-        }
-
-        if (!wc_match(swcm->wildcard, name->filename))
-            continue;                  /* doesn't match the wildcard */
+    if (swcm->namepos >= swcm->nnames)
+        return NULL;
 
-        /*
-         * We have a working filename. Return it.
-         */
-        return dupprintf("%s%s%s", swcm->prefix,
-                         (!swcm->prefix[0] ||
-                          swcm->prefix[strlen(swcm->prefix)-1]=='/' ?
-                          "" : "/"),
-                         name->filename);
-    }
+    /*
+     * We have a working filename. Return it.
+     */
+    return dupprintf("%s%s%s", swcm->prefix,
+                     (!swcm->prefix[0] ||
+                      swcm->prefix[strlen(swcm->prefix)-1]=='/' ?
+                      "" : "/"),
+                     swcm->names[swcm->namepos++]);
 }
 
 void sftp_finish_wildcard_matching(SftpWildcardMatcher *swcm)
 {
-    struct sftp_packet *pktin;
-    struct sftp_request *req;
-
-    req = fxp_close_send(swcm->dirh);
-    pktin = sftp_wait_for_reply(req);
-    fxp_close_recv(pktin, req);
-
-    if (swcm->names)
-        fxp_free_names(swcm->names);
-
+    for (size_t i = 0; i < swcm->nnames; i++)
+        sfree(swcm->names[i]);
+    sfree(swcm->names);
     sfree(swcm->prefix);
-    sfree(swcm->wildcard);
 
     sfree(swcm);
 }
@@ -1106,12 +1105,10 @@ int sftp_cmd_ls(struct sftp_command *cmd)
     } else {
         struct list_directory_from_sftp_ctx *ctx =
             list_directory_from_sftp_new();
+        struct fxp_dirread *dr = dirread_init(dirh);
 
         while (1) {
-
-            req = fxp_readdir_send(dirh);
-            pktin = sftp_wait_for_reply(req);
-            names = fxp_readdir_recv(pktin, req);
+            names = dirread_next(dr);
 
             if (names == NULL) {
                 if (fxp_error_type() == SSH_FX_EOF)
@@ -1119,10 +1116,6 @@ int sftp_cmd_ls(struct sftp_command *cmd)
                 printf("Reading directory %s: %s\n", dir, fxp_error());
                 break;
             }
-            if (names->nnames == 0) {
-                fxp_free_names(names);
-                break;
-            }
 
             for (size_t i = 0; i < names->nnames; i++)
                 if (!wildcard || wc_match(wildcard, names->names[i].filename))
@@ -1131,6 +1124,7 @@ int sftp_cmd_ls(struct sftp_command *cmd)
             fxp_free_names(names);
         }
 
+        dirread_cleanup(dr);
         req = fxp_close_send(dirh);
         pktin = sftp_wait_for_reply(req);
         fxp_close_recv(pktin, req);
@@ -1279,7 +1273,7 @@ int sftp_general_get(struct sftp_command *cmd, bool restart, bool multiple)
             else
                 outfname = stripslashes(origwfname, false);
 
-            toret = sftp_get_file(fname, outfname, recurse, restart);
+            toret = sftp_get_file(fname, outfname, recurse, restart, NULL);
 
             sfree(fname);
 
@@ -52,6 +52,16 @@ struct psocks_state {
     char *rec_cmd;
     bool got_subcmd;
 
+    /*
+     * Running statistics, reported by psocks_dump_stats. 'conns' is a
+     * list of all the currently open connections, so that we can add
+     * up how much data is sitting in buffers.
+     */
+    psocks_connection *conns;
+    uint64_t nconns_active, nconns_peak, nconns_failed, nconns_spliced;
+    uint64_t bytes[2], last_bytes[2];
+    unsigned long last_dump_time;
+
     ConnectionLayer cl;
 };
 
@@ -65,6 +75,13 @@ struct psocks_connection {
     bool connecting, eof_pfmgr_to_socket, eof_socket_to_pfmgr;
     uint64_t index;
     PsocksDataSink *rec_sink;
+    bool splice_tried;
+
+    /* Data buffered in each direction, as last reported to us, and
+     * the most we've ever seen buffered. */
+    size_t backlog[2], peak_backlog[2];
+
+    psocks_connection *prev, *next;
 
     Plug plug;
     SshChannel sc;
@@ -152,6 +169,7 @@ static void psocks_conn_log_data(psocks_connection *conn, PsocksDirection dir,
 }
 
 static void psocks_connection_establish(void *vctx);
+static void psocks_try_splice(psocks_connection *conn);
 
 static SshChannel *psocks_lportfwd_open(
     ConnectionLayer *cl, const char *hostname, int port,
@@ -167,6 +185,15 @@ static SshChannel *psocks_lportfwd_open(
     conn->host = dupstr(hostname);
     conn->port = port;
     conn->index = ps->next_conn_index++;
+
+    conn->prev = NULL;
+    conn->next = ps->conns;
+    if (ps->conns)
+        ps->conns->prev = conn;
+    ps->conns = conn;
+    if (++ps->nconns_active > ps->nconns_peak)
+        ps->nconns_peak = ps->nconns_active;
+
     if (conn->ps->log_flags & LOG_CONNSTATUS)
         psocks_conn_log(conn, "request from %s for %s port %d",
                         pi->log_text, hostname, port);
@@ -231,10 +258,30 @@ static SshChannel *psocks_lportfwd_open(
     return &conn->sc;
 }
 
+static void psocks_conn_set_backlog(psocks_connection *conn,
+                                    PsocksDirection dir, size_t bufsize)
+{
+    conn->backlog[dir] = bufsize;
+    if (bufsize > conn->peak_backlog[dir])
+        conn->peak_backlog[dir] = bufsize;
+}
+
 static void psocks_conn_free(psocks_connection *conn)
 {
-    if (conn->ps->log_flags & LOG_CONNSTATUS)
-        psocks_conn_log(conn, "closed");
+    psocks_state *ps = conn->ps;
+
+    if (ps->log_flags & LOG_CONNSTATUS)
+        psocks_conn_log(conn, "closed (peak buffered: %"SIZEu" sent, "
+                        "%"SIZEu" received)", conn->peak_backlog[UP],
+                        conn->peak_backlog[DN]);
+
+    if (conn->prev)
+        conn->prev->next = conn->next;
+    else
+        ps->conns = conn->next;
+    if (conn->next)
+        conn->next->prev = conn->prev;
+    ps->nconns_active--;
 
     sfree(conn->host);
     sfree(conn->realhost);
@@ -263,6 +310,7 @@ static void psocks_connection_establish(void *vctx)
         chan_open_failed(conn->chan, msg);
         sfree(msg);
 
+        conn->ps->nconns_failed++;
         psocks_conn_free(conn);
         return;
     }
@@ -282,8 +330,12 @@ static size_t psocks_sc_write(SshChannel *sc, bool is_stderr,
     if (!conn->socket) return 0;
 
     psocks_conn_log_data(conn, UP, data, len);
+    conn->ps->bytes[UP] += len;
 
-    return sk_write(conn->socket, data, len);
+    size_t bufsize = sk_write(conn->socket, data, len);
+    psocks_conn_set_backlog(conn, UP, bufsize);
+    psocks_try_splice(conn);
+    return bufsize;
 }
 
 static void psocks_check_close(void *vctx)
@@ -317,10 +369,40 @@ static void psocks_sc_initiate_close(SshChannel *sc, const char *err)
 static void psocks_sc_unthrottle(SshChannel *sc, size_t bufsize)
 {
     psocks_connection *conn = container_of(sc, psocks_connection, sc);
+    psocks_conn_set_backlog(conn, DN, bufsize);
     if (bufsize < BUFLIMIT)
 	sk_set_frozen(conn->socket, false);
 }
 
+/*
+ * The first time data passes through an established connection, if
+ * nobody wants to see it, ask the platform to relay the rest directly
+ * between the two sockets, without copying it through our own
+ * buffers.
+ */
+static void psocks_try_splice(psocks_connection *conn)
+{
+    psocks_state *ps = conn->ps;
+
+    if (conn->splice_tried || !ps->platform->splice ||
+        (ps->log_flags & LOG_DIALOGUE) || conn->rec_sink ||
+        !conn->socket || conn->connecting ||
+        conn->eof_pfmgr_to_socket || conn->eof_socket_to_pfmgr)
+        return;
+
+    Socket *client = portfwd_raw_socket(conn->chan);
+    if (!client)
+        return;                        /* still setting up; try later */
+
+    conn->splice_tried = true;
+    if (!ps->platform->splice(client, conn->socket))
+        return;
+
+    ps->nconns_spliced++;
+    if (ps->log_flags & LOG_CONNSTATUS)
+        psocks_conn_log(conn, "relaying data directly between sockets");
+}
+
 static void psocks_plug_log(Plug *plug, Socket *s, PlugLogType type,
                             SockAddr *addr, int port,
                             const char *error_msg, int error_code)
@@ -365,6 +447,7 @@ static void psocks_plug_closing(Plug *plug, PlugCloseType type,
             psocks_conn_log(conn, "unable to connect: %s", error_msg);
 
         chan_open_failed(conn->chan, error_msg);
+        conn->ps->nconns_failed++;
         conn->eof_socket_to_pfmgr = true;
         conn->eof_pfmgr_to_socket = true;
         conn->connecting = false;
@@ -384,14 +467,58 @@ static void psocks_plug_receive(Plug *plug, int urgent,
     psocks_connection *conn = container_of(plug, psocks_connection, plug);
     size_t bufsize = chan_send(conn->chan, false, data, len);
     sk_set_frozen(conn->socket, bufsize > BUFLIMIT);
+    psocks_conn_set_backlog(conn, DN, bufsize);
+    conn->ps->bytes[DN] += len;
 
     psocks_conn_log_data(conn, DN, data, len);
+    psocks_try_splice(conn);
 }
 
 static void psocks_plug_sent(Plug *plug, size_t bufsize)
 {
     psocks_connection *conn = container_of(plug, psocks_connection, plug);
     sk_set_frozen(conn->socket, bufsize > BUFLIMIT);
+    psocks_conn_set_backlog(conn, UP, bufsize);
+}
+
+/*
+ * Report the running statistics to the log. The platform front end
+ * calls this on request (on Unix, when we receive SIGUSR1).
+ */
+void psocks_dump_stats(psocks_state *ps)
+{
+    if (!ps->logging_fp)
+        return;
+
+    size_t buffered[2] = { 0, 0 };
+    for (psocks_connection *conn = ps->conns; conn; conn = conn->next)
+        for (size_t i = 0; i < 2; i++)
+            buffered[i] += conn->backlog[i];
+
+    unsigned long now = GETTICKCOUNT();
+    unsigned long ms = (now - ps->last_dump_time) * 1000 / TICKSPERSEC;
+    uint64_t rate[2];
+    for (size_t i = 0; i < 2; i++) {
+        rate[i] = ms ? (ps->bytes[i] - ps->last_bytes[i]) * 1000 / ms : 0;
+        ps->last_bytes[i] = ps->bytes[i];
+    }
+    ps->last_dump_time = now;
+
+    fprintf(ps->logging_fp, "stats: connections: %"PRIu64" total, "
+            "%"PRIu64" active, %"PRIu64" peak, %"PRIu64" failed, "
+            "%"PRIu64" relayed directly\n",
+            ps->next_conn_index, ps->nconns_active, ps->nconns_peak,
+            ps->nconns_failed, ps->nconns_spliced);
+    /* Data on directly relayed connections never passes through us,
+     * so it isn't counted here */
+    fprintf(ps->logging_fp, "stats: bytes: %"PRIu64" sent, "
+            "%"PRIu64" received; buffered: %"SIZEu" sent, "
+            "%"SIZEu" received\n", ps->bytes[UP], ps->bytes[DN],
+            buffered[UP], buffered[DN]);
+    fprintf(ps->logging_fp, "stats: since last report (%lu ms): "
+            "%"PRIu64" bytes/s sent, %"PRIu64" bytes/s received\n",
+            ms, rate[UP], rate[DN]);
+    fflush(ps->logging_fp);
 }
 
 psocks_state *psocks_new(const PsocksPlatform *platform)
@@ -409,6 +536,7 @@ psocks_state *psocks_new(const PsocksPlatform *platform)
     ps->log_flags = LOG_CONNSTATUS;
     ps->rec_dest = REC_NONE;
     ps->platform = platform;
+    ps->last_dump_time = GETTICKCOUNT();
 
     return ps;
 }
@@ -21,9 +21,11 @@ struct PsocksPlatform {
         const char *index_arg, char **err);
     void (*found_subcommand)(CmdlineArg *arg);
     void (*start_subcommand)(void);
+    bool (*splice)(Socket *a, Socket *b);
 };
 
 psocks_state *psocks_new(const PsocksPlatform *);
 void psocks_free(psocks_state *ps);
 void psocks_cmdline(psocks_state *ps, CmdlineArgList *arglist);
 void psocks_start(psocks_state *ps);
+void psocks_dump_stats(psocks_state *ps);
@@ -1681,6 +1681,8 @@ struct TermWinVtable {
 
     void (*bell)(TermWin *, int mode);
 
+    /* attrs and colours may be NULL, if the front end hasn't asked
+     * for rich-text copying via CONF_rtf_paste */
     void (*clip_write)(TermWin *, int clipboard, wchar_t *text, int *attrs,
                        truecolour *colours, int len, bool must_deselect);
     void (*clip_request_paste)(TermWin *, int clipboard);
@@ -2066,6 +2068,7 @@ void term_blink(Terminal *, bool set_cursor);
 void term_do_paste(Terminal *, const wchar_t *, size_t);
 void term_nopaste(Terminal *);
 void term_copyall(Terminal *, const int *, int);
+void term_save_scrollback(Terminal *, BinarySink *);
 void term_pre_reconfig(Terminal *, Conf *);
 void term_reconfig(Terminal *, Conf *);
 void term_request_copy(Terminal *, const int *clipboards, int n_clipboards);
@@ -158,7 +158,10 @@ static const SshChannelVtable ssh2channel_vtable = {
 static void ssh2_channel_check_close(struct ssh2_channel *c);
 static void ssh2_channel_try_eof(struct ssh2_channel *c);
 static void ssh2_set_window(struct ssh2_channel *c, int newwin);
+static void ssh2_channel_grow_window(struct ssh2_channel *c, int64_t newmax);
 static size_t ssh2_try_send(struct ssh2_channel *c);
+static void ssh2_connection_schedule(void *vctx);
+static void ssh2_channel_set_sched_class(struct ssh2_channel *c, ptrlen type);
 static void ssh2_try_send_and_unthrottle(struct ssh2_channel *c);
 static void ssh2_channel_check_throttle(struct ssh2_channel *c);
 static void ssh2_channel_close_local(struct ssh2_channel *c,
@@ -219,6 +222,21 @@ struct outstanding_channel_request {
     struct outstanding_channel_request *next;
 };
 
+/*
+ * Work out the largest receive window we're prepared to grow a
+ * channel to, from the configured limit.
+ */
+static int ssh2_connection_max_window(Conf *conf)
+{
+    unsigned long max = parse_blocksize(
+        conf_get_str(conf, CONF_ssh_max_window));
+    if (max < OUR_V2_WINSIZE)
+        max = OUR_V2_WINSIZE;
+    if (max > 0x70000000)
+        max = 0x70000000;          /* leave headroom below INT_MAX */
+    return max;
+}
+
 static void ssh2_channel_free(struct ssh2_channel *c)
 {
     bufchain_clear(&c->outbuffer);
@@ -230,6 +248,16 @@ static void ssh2_channel_free(struct ssh2_channel *c)
     }
     if (c->chan) {
         struct ssh2_connection_state *s = c->connlayer;
+        PacketProtocolLayer *ppl = &s->ppl; /* for ppl_logevent */
+        if (c->window_increases)
+            ppl_logevent("Channel %u: receive window grew to %d bytes "
+                         "(%"PRIu64" bytes received, last RTT %lu ms)",
+                         c->localid, c->locmaxwin, c->bytes_received,
+                         c->last_rtt * 1000 / TICKSPERSEC);
+        if (c->sched_peak)
+            ppl_logevent("Channel %u: held back up to %"SIZEu" bytes of "
+                         "outgoing data while connection was busy",
+                         c->localid, c->sched_peak);
         if (s->mainchan_sc == &c->sc) {
             s->mainchan = NULL;
             s->mainchan_sc = NULL;
@@ -249,6 +277,10 @@ PacketProtocolLayer *ssh2_connection_new(
     s->ppl.vt = &ssh2_connection_vtable;
 
     s->conf = conf_copy(conf);
+    s->max_window = ssh2_connection_max_window(s->conf);
+
+    s->ic_sched.fn = ssh2_connection_schedule;
+    s->ic_sched.ctx = s;
 
     s->ssh_is_simple = is_simple;
 
@@ -425,6 +457,7 @@ static bool ssh2_connection_filter_queue(struct ssh2_connection_state *s)
             } else {
                 c->chan = chanopen_result.u.success.channel;
                 ssh2_channel_init(c);
+                ssh2_channel_set_sched_class(c, type);
                 c->remwindow = winsize;
                 c->remmaxpkt = pktsize;
                 if (c->remmaxpkt > s->ppl.bpp->vt->packet_size_limit)
@@ -543,6 +576,7 @@ static bool ssh2_connection_filter_queue(struct ssh2_connection_state *s)
                     int bufsize;
                     c->locwindow -= data.len;
                     c->remlocwin -= data.len;
+                    c->bytes_received += data.len;
                     if (ext_type != 0 && ext_type != SSH2_EXTENDED_DATA_STDERR)
                         data.len = 0; /* ignore unknown extended data */
                     bufsize = chan_send(
@@ -566,9 +600,11 @@ static bool ssh2_connection_filter_queue(struct ssh2_connection_state *s)
                      * think about using a larger window.
                      */
                     if (c->remlocwin <= 0 &&
-                        c->throttle_state == UNTHROTTLED &&
-                        c->locmaxwin < 0x40000000)
-                        c->locmaxwin += OUR_V2_WINSIZE;
+                        c->throttle_state == UNTHROTTLED) {
+                        c->window_exhausted = true;
+                        ssh2_channel_grow_window(c, c->locmaxwin +
+                                                 OUR_V2_WINSIZE);
+                    }
 
                     /*
                      * If we are not buffering too much data, enlarge
@@ -861,10 +897,36 @@ static bool ssh2_connection_filter_queue(struct ssh2_connection_state *s)
     }
 }
 
+/*
+ * Raise a channel's maximum receive window towards 'newmax', subject
+ * to the configured ceiling. Never shrinks it.
+ */
+static void ssh2_channel_grow_window(struct ssh2_channel *c, int64_t newmax)
+{
+    struct ssh2_connection_state *s = c->connlayer;
+
+    if (newmax > s->max_window)
+        newmax = s->max_window;
+    if (newmax > c->locmaxwin) {
+        c->locmaxwin = newmax;
+        c->window_increases++;
+    }
+}
+
+/*
+ * Context for a winadj@putty request, recording enough about the
+ * moment we sent it to measure the round trip when the reply comes.
+ */
+struct winadj_ctx {
+    unsigned size;
+    unsigned long sent_time;
+    uint64_t bytes_received;
+};
+
 static void ssh2_handle_winadj_response(struct ssh2_channel *c,
                                         PktIn *pktin, void *ctx)
 {
-    unsigned *sizep = ctx;
+    struct winadj_ctx *wctx = ctx;
 
     /*
      * Winadj responses should always be failures. However, at least
@@ -874,8 +936,24 @@ static void ssh2_handle_winadj_response(struct ssh2_channel *c,
      * life, we don't worry about what kind of response we got.
      */
 
-    c->remlocwin += *sizep;
-    sfree(sizep);
+    c->remlocwin += wctx->size;
+
+    /*
+     * If the remote end exhausted its window at any point since it
+     * was last acknowledged, then the window is smaller than the
+     * link's bandwidth-delay product. The amount of data that got
+     * through in the round trip just measured is a lower bound on
+     * that, so make sure the window is at least twice as big, which
+     * converges as fast as TCP slow start without overshooting by
+     * more than a factor of two.
+     */
+    c->last_rtt = GETTICKCOUNT() - wctx->sent_time;
+    if (c->window_exhausted) {
+        ssh2_channel_grow_window(
+            c, 2 * (int64_t)(c->bytes_received - wctx->bytes_received));
+        c->window_exhausted = false;
+    }
+    sfree(wctx);
     /*
      * winadj messages are only sent when the window is fully open, so
      * if we get an ack of one, we know any pending unthrottle is
@@ -924,7 +1002,7 @@ static void ssh2_set_window(struct ssh2_channel *c, int newwin)
      */
     if (newwin / 2 >= c->locwindow) {
         PktOut *pktout;
-        unsigned *up;
+        struct winadj_ctx *wctx;
 
         /*
          * In order to keep track of how much window the client
@@ -938,10 +1016,12 @@ static void ssh2_set_window(struct ssh2_channel *c, int newwin)
          */
         if (newwin == c->locmaxwin &&
             !(s->ppl.remote_bugs & BUG_CHOKES_ON_WINADJ)) {
-            up = snew(unsigned);
-            *up = newwin - c->locwindow;
+            wctx = snew(struct winadj_ctx);
+            wctx->size = newwin - c->locwindow;
+            wctx->sent_time = GETTICKCOUNT();
+            wctx->bytes_received = c->bytes_received;
             pktout = ssh2_chanreq_init(c, "winadj@putty.projects.tartarus.org",
-                                       ssh2_handle_winadj_response, up);
+                                       ssh2_handle_winadj_response, wctx);
             pq_push(s->ppl.out_pq, pktout);
 
             if (c->throttle_state != UNTHROTTLED)
@@ -1106,41 +1186,101 @@ static void ssh2_channel_try_eof(struct ssh2_channel *c)
     ssh2_channel_check_close(c);
 }
 
+/*
+ * Decide which scheduling class a channel's outgoing data belongs in,
+ * from the channel type in its CHANNEL_OPEN.
+ */
+static void ssh2_channel_set_sched_class(struct ssh2_channel *c, ptrlen type)
+{
+    if (ptrlen_eq_string(type, "session"))
+        c->sched_class = SCHED_INTERACTIVE;
+    else if (ptrlen_eq_string(type, "auth-agent@openssh.com"))
+        c->sched_class = SCHED_AGENT;
+    else if (ptrlen_eq_string(type, "x11"))
+        c->sched_class = SCHED_X11;
+    else
+        c->sched_class = SCHED_BULK;
+}
+
+/*
+ * Return true if a channel has outgoing data and the remote window
+ * to send some of it.
+ */
+static bool ssh2_channel_can_send(struct ssh2_channel *c)
+{
+    return !c->halfopen && c->remwindow > 0 &&
+        (bufchain_size(&c->outbuffer) > 0 ||
+         bufchain_size(&c->errbuffer) > 0);
+}
+
+/*
+ * Return true if a channel's outgoing data must wait for the
+ * scheduler rather than being sent straight away: that is, if it's in
+ * a low-priority class, and either the SSH connection is currently
+ * backed up or other channels are already waiting their turn.
+ */
+static bool ssh2_channel_must_wait(struct ssh2_channel *c)
+{
+    struct ssh2_connection_state *s = c->connlayer;
+    return c->sched_class >= SCHED_X11 &&
+        (s->all_channels_throttled || s->ic_sched.queued);
+}
+
+/*
+ * Send a single CHANNEL_DATA or CHANNEL_EXTENDED_DATA packet, of at
+ * most 'limit' bytes, from a channel's buffers. Returns the amount of
+ * data sent. Precondition: ssh2_channel_can_send(c).
+ */
+static size_t ssh2_send_one_packet(struct ssh2_channel *c, size_t limit)
+{
+    struct ssh2_connection_state *s = c->connlayer;
+    PktOut *pktout;
+    bufchain *buf = (bufchain_size(&c->errbuffer) > 0 ?
+                     &c->errbuffer : &c->outbuffer);
+
+    ptrlen data = bufchain_prefix(buf);
+    if (data.len > c->remwindow)
+        data.len = c->remwindow;
+    if (data.len > c->remmaxpkt)
+        data.len = c->remmaxpkt;
+    if (data.len > limit)
+        data.len = limit;
+    if (buf == &c->errbuffer) {
+        pktout = ssh_bpp_new_pktout(
+            s->ppl.bpp, SSH2_MSG_CHANNEL_EXTENDED_DATA);
+        put_uint32(pktout, c->remoteid);
+        put_uint32(pktout, SSH2_EXTENDED_DATA_STDERR);
+    } else {
+        pktout = ssh_bpp_new_pktout(s->ppl.bpp, SSH2_MSG_CHANNEL_DATA);
+        put_uint32(pktout, c->remoteid);
+    }
+    put_stringpl(pktout, data);
+    pq_push(s->ppl.out_pq, pktout);
+    bufchain_consume(buf, data.len);
+    c->remwindow -= data.len;
+    return data.len;
+}
+
 /*
  * Attempt to send data on an SSH-2 channel.
  */
 static size_t ssh2_try_send(struct ssh2_channel *c)
 {
     struct ssh2_connection_state *s = c->connlayer;
-    PktOut *pktout;
     size_t bufsize;
 
-    if (!c->halfopen) {
-        while (c->remwindow > 0 &&
-               (bufchain_size(&c->outbuffer) > 0 ||
-                bufchain_size(&c->errbuffer) > 0)) {
-            bufchain *buf = (bufchain_size(&c->errbuffer) > 0 ?
-                             &c->errbuffer : &c->outbuffer);
-
-            ptrlen data = bufchain_prefix(buf);
-            if (data.len > c->remwindow)
-                data.len = c->remwindow;
-            if (data.len > c->remmaxpkt)
-                data.len = c->remmaxpkt;
-            if (buf == &c->errbuffer) {
-                pktout = ssh_bpp_new_pktout(
-                    s->ppl.bpp, SSH2_MSG_CHANNEL_EXTENDED_DATA);
-                put_uint32(pktout, c->remoteid);
-                put_uint32(pktout, SSH2_EXTENDED_DATA_STDERR);
-            } else {
-                pktout = ssh_bpp_new_pktout(s->ppl.bpp, SSH2_MSG_CHANNEL_DATA);
-                put_uint32(pktout, c->remoteid);
-            }
-            put_stringpl(pktout, data);
-            pq_push(s->ppl.out_pq, pktout);
-            bufchain_consume(buf, data.len);
-            c->remwindow -= data.len;
-        }
+    if (ssh2_channel_must_wait(c)) {
+        /*
+         * Leave the data where it is. If the connection isn't backed
+         * up, make sure the scheduler will get round to us; if it
+         * is, ssh2_throttle_all_channels will start the scheduler
+         * when it clears.
+         */
+        if (ssh2_channel_can_send(c) && !s->all_channels_throttled)
+            queue_idempotent_callback(&s->ic_sched);
+    } else {
+        while (ssh2_channel_can_send(c))
+            ssh2_send_one_packet(c, SIZE_MAX);
     }
 
     /*
@@ -1148,6 +1288,8 @@ static size_t ssh2_try_send(struct ssh2_channel *c)
      * still buffered.
      */
     bufsize = bufchain_size(&c->outbuffer) + bufchain_size(&c->errbuffer);
+    if (bufsize > c->sched_peak && ssh2_channel_must_wait(c))
+        c->sched_peak = bufsize;
 
     /*
      * And if there's no data pending but we need to send an EOF, send
@@ -1160,6 +1302,74 @@ static size_t ssh2_try_send(struct ssh2_channel *c)
     return bufsize;
 }
 
+/*
+ * The quantum of data each channel in a class is allowed per round of
+ * the scheduler, and the most we'll hand down to the transport in one
+ * run of it before letting the lower layers catch up.
+ */
+#define SCHED_QUANTUM OUR_V2_MAXPKT
+#define SCHED_BUDGET SSH_MAX_BACKLOG
+
+static void ssh2_connection_schedule(void *vctx)
+{
+    struct ssh2_connection_state *s = (struct ssh2_connection_state *)vctx;
+    struct ssh2_channel *c;
+    size_t budget = SCHED_BUDGET;
+    int i;
+
+    /* If the connection has backed up again, wait until it unblocks,
+     * at which point we'll be called again. */
+    if (s->all_channels_throttled)
+        return;
+
+    for (int class = 0; class < SCHED_NCLASSES && budget > 0; class++) {
+        bool progress = true;
+
+        while (progress && budget > 0) {
+            progress = false;
+
+            for (i = 0; budget > 0 &&
+                     NULL != (c = index234(s->channels, i)); i++) {
+                if (c->sched_class != class || c->sharectx ||
+                    (c->closes & CLOSES_SENT_EOF) ||
+                    !ssh2_channel_can_send(c))
+                    continue;
+
+                c->sched_deficit += SCHED_QUANTUM;
+                while (budget > 0 && c->sched_deficit > 0 &&
+                       ssh2_channel_can_send(c)) {
+                    size_t limit = (c->sched_deficit < budget ?
+                                    c->sched_deficit : budget);
+                    size_t sent = ssh2_send_one_packet(c, limit);
+                    c->sched_deficit -= sent;
+                    budget -= sent;
+                    progress = true;
+                }
+
+                if (!ssh2_channel_can_send(c)) {
+                    /* A channel with nothing left to send doesn't get
+                     * to bank its unused quantum. */
+                    c->sched_deficit = 0;
+                    if (bufchain_size(&c->outbuffer) +
+                        bufchain_size(&c->errbuffer) == 0) {
+                        c->throttled_by_backlog = false;
+                        ssh2_channel_check_throttle(c);
+                        if (c->pending_eof)
+                            ssh2_channel_try_eof(c);
+                    }
+                }
+            }
+        }
+    }
+
+    /* If we ran out of budget, there may be more to do once the
+     * packets we've just queued have made their way downwards. */
+    if (budget == 0)
+        queue_idempotent_callback(&s->ic_sched);
+
+    ssh_sendbuffer_changed(s->ppl.ssh);
+}
+
 static void ssh2_try_send_and_unthrottle(struct ssh2_channel *c)
 {
     int bufsize;
@@ -1291,6 +1501,13 @@ void ssh2_channel_init(struct ssh2_channel *c)
         s->ssh_is_simple ? OUR_V2_BIGWIN : OUR_V2_WINSIZE;
     c->chanreq_head = NULL;
     c->throttle_state = UNTHROTTLED;
+    c->bytes_received = 0;
+    c->window_exhausted = false;
+    c->last_rtt = 0;
+    c->window_increases = 0;
+    c->sched_class = SCHED_BULK;
+    c->sched_deficit = 0;
+    c->sched_peak = 0;
     bufchain_init(&c->outbuffer);
     bufchain_init(&c->errbuffer);
     c->sc.vt = &ssh2channel_vtable;
@@ -1311,6 +1528,7 @@ PktOut *ssh2_chanopen_init(struct ssh2_channel *c, const char *type)
     put_stringz(pktout, type);
     put_uint32(pktout, c->localid);
     put_uint32(pktout, c->locwindow);     /* our window size */
+    ssh2_channel_set_sched_class(c, ptrlen_from_asciz(type));
     put_uint32(pktout, OUR_V2_MAXPKT);    /* our max pkt size */
     return pktout;
 }
@@ -1676,6 +1894,10 @@ static void ssh2_throttle_all_channels(ConnectionLayer *cl, bool throttled)
     for (i = 0; NULL != (c = index234(s->channels, i)); i++)
         if (!c->sharectx)
             ssh2_channel_check_throttle(c);
+
+    /* Let any channels that have been holding back data send it. */
+    if (!throttled)
+        queue_idempotent_callback(&s->ic_sched);
 }
 
 static bool ssh2_ldisc_option(ConnectionLayer *cl, int option)
@@ -1741,6 +1963,7 @@ static void ssh2_connection_reconfigure(PacketProtocolLayer *ppl, Conf *conf)
 
     conf_free(s->conf);
     s->conf = conf_copy(conf);
+    s->max_window = ssh2_connection_max_window(s->conf);
 
     if (s->portfwdmgr_configured)
         portfwdmgr_config(s->portfwdmgr, s->conf);
@@ -23,6 +23,11 @@ struct ssh2_connection_state {
     bool started;
 
     Conf *conf;
+    int max_window;                    /* from CONF_ssh_max_window */
+
+    /* Runs ssh2_connection_schedule, to hand down outgoing data that
+     * lower-priority channels have been holding back. */
+    IdempotentCallback ic_sched;
 
     tree234 *channels;                 /* indexed by local id */
     bool all_channels_throttled;
@@ -54,6 +59,22 @@ struct ssh2_connection_state {
     PacketProtocolLayer ppl;
 };
 
+/*
+ * Priority classes for outgoing channel data, highest first. Data on
+ * the first two classes is always sent as soon as the remote window
+ * allows. Data on the others is held back in the channel's own buffer
+ * while the SSH connection is backed up, and handed down afterwards
+ * by ssh2_connection_schedule, which serves the classes in order and
+ * the channels within each class by deficit round robin.
+ */
+enum {
+    SCHED_INTERACTIVE,  /* session channels */
+    SCHED_AGENT,        /* agent forwarding */
+    SCHED_X11,          /* X11 forwarding */
+    SCHED_BULK,         /* port forwardings, and anything else */
+    SCHED_NCLASSES
+};
+
 typedef void (*gr_handler_fn_t)(struct ssh2_connection_state *s,
                                 PktIn *pktin, void *ctx);
 void ssh2_queue_global_request_handler(
@@ -110,6 +131,27 @@ struct ssh2_channel {
      */
     int remlocwin;
 
+    /*
+     * Statistics used to auto-tune locmaxwin. We count the data the
+     * remote end has sent us, and each time a winadj@putty request
+     * comes back we know the round-trip time and how much data
+     * arrived during it. If the remote end ran out of window during
+     * that time, we were limiting its throughput, so we raise
+     * locmaxwin to comfortably cover what it managed to send in a
+     * round trip.
+     */
+    uint64_t bytes_received;
+    bool window_exhausted;             /* since the last winadj response */
+    unsigned long last_rtt;            /* in ticks */
+    unsigned window_increases;
+
+    /* Outgoing data scheduling: one of the SCHED_* classes above, the
+     * channel's current round-robin deficit, and the largest amount
+     * of data we've held back in its buffers at once. */
+    int sched_class;
+    size_t sched_deficit;
+    size_t sched_peak;
+
     /*
      * These store the list of channel requests that we're waiting for
      * replies to. (CHANNEL_FAILURE doesn't come with any indication
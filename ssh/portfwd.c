@@ -501,6 +501,21 @@ void portfwd_raw_setup(Channel *pfchan, Socket *s, SshChannel *sc)
     pf->c = sc;
 }
 
+/*
+ * Return the local socket of a port forwarding, once the forwarding
+ * is fully set up (so that its SOCKS negotiation, if any, is over and
+ * everything it receives from now on is plain data). Returns NULL if
+ * that isn't the case yet, or if this isn't a port forwarding at all.
+ */
+Socket *portfwd_raw_socket(Channel *pfchan)
+{
+    if (pfchan->vt != &PortForwarding_channelvt)
+        return NULL;
+    struct PortForwarding *pf = container_of(
+        pfchan, struct PortForwarding, chan);
+    return (pf->ready && !pf->socksbuf) ? pf->s : NULL;
+}
+
 /*
  * called when someone connects to the local port
  */
@@ -47,6 +47,8 @@ typedef struct sesschan {
 
     bufchain subsys_input;
     SftpServer *sftpsrv;
+    IdempotentCallback ic_sftp;        /* runs sftp_process_requests */
+    bool sftp_output_wanted, sftp_eof_pending;
     ScpServer *scpsrv;
     const SshServerConfig *ssc;
 
@@ -106,6 +108,8 @@ static size_t sftp_chan_send(
     Channel *chan, bool is_stderr, const void *, size_t);
 static void sftp_chan_send_eof(Channel *chan);
 static char *sftp_log_close_msg(Channel *chan);
+static void sftp_chan_set_input_wanted(Channel *chan, bool wanted);
+static void sftp_process_requests(void *ctx);
 
 static const ChannelVtable sftp_channelvt = {
     .free = sesschan_free,
@@ -113,7 +117,7 @@ static const ChannelVtable sftp_channelvt = {
     .open_failed = chan_remotely_opened_failure,
     .send = sftp_chan_send,
     .send_eof = sftp_chan_send_eof,
-    .set_input_wanted = sesschan_set_input_wanted,
+    .set_input_wanted = sftp_chan_set_input_wanted,
     .log_close_msg = sftp_log_close_msg,
     .want_close = chan_default_want_close,
     .rcvd_exit_status = chan_no_exit_status,
@@ -364,6 +368,9 @@ bool sesschan_run_subsystem(Channel *chan, ptrlen subsys)
     if (ptrlen_eq_string(subsys, "sftp") && sess->sftpserver_vt) {
         sess->sftpsrv = sftpsrv_new(sess->sftpserver_vt);
         sess->chan.vt = &sftp_channelvt;
+        sess->ic_sftp.fn = sftp_process_requests;
+        sess->ic_sftp.ctx = sess;
+        sess->sftp_output_wanted = true;
         logevent(sess->parent_logctx, "Starting built-in SFTP subsystem");
         return true;
     }
@@ -721,27 +728,43 @@ static bool sesschan_get_window_pixel_size(Seat *seat, int *width, int *height)
  * Built-in SFTP subsystem.
  */
 
-static size_t sftp_chan_send(Channel *chan, bool is_stderr,
-                             const void *data, size_t length)
-{
-    sesschan *sess = container_of(chan, sesschan, chan);
+/*
+ * Incoming SFTP requests are queued in subsys_input, and handled from
+ * a callback a limited number at a time, so that a client pipelining
+ * a large batch of requests can't monopolise the event loop at the
+ * expense of other channels and connections. We also stop handling
+ * them while our replies are backed up in the SSH connection, and
+ * report the unprocessed input as our buffer size, so that the
+ * connection layer stops opening the client's window.
+ */
+#define SFTP_REQUESTS_PER_CALLBACK 16
 
-    bufchain_add(&sess->subsys_input, data, length);
+static void sftp_process_requests(void *ctx)
+{
+    sesschan *sess = (sesschan *)ctx;
+    bool consumed = false;
 
-    while (bufchain_size(&sess->subsys_input) >= 4) {
+    for (unsigned n = 0; n < SFTP_REQUESTS_PER_CALLBACK; n++) {
         char lenbuf[4];
         unsigned pktlen;
         struct sftp_packet *pkt, *reply;
 
+        if (!sess->sftp_output_wanted)
+            goto out;  /* sftp_chan_set_input_wanted will requeue us */
+
+        if (bufchain_size(&sess->subsys_input) < 4)
+            goto no_more;
+
         bufchain_fetch(&sess->subsys_input, lenbuf, 4);
         pktlen = GET_32BIT_MSB_FIRST(lenbuf);
 
         if (bufchain_size(&sess->subsys_input) - 4 < pktlen)
-            break;                     /* wait for more data */
+            goto no_more;              /* wait for more data */
 
         bufchain_consume(&sess->subsys_input, 4);
         pkt = sftp_recv_prepare(pktlen);
         bufchain_fetch_consume(&sess->subsys_input, pkt->data, pktlen);
+        consumed = true;
         sftp_recv_finish(pkt);
         reply = sftp_handle_request(sess->sftpsrv, pkt);
         sftp_pkt_free(pkt);
@@ -751,13 +774,48 @@ static size_t sftp_chan_send(Channel *chan, bool is_stderr,
         sftp_pkt_free(reply);
     }
 
-    return 0;
+    /* There may be more to do, but let everything else have a turn */
+    queue_idempotent_callback(&sess->ic_sftp);
+    goto out;
+
+  no_more:
+    /* Only pass on EOF once we've answered everything before it */
+    if (sess->sftp_eof_pending) {
+        sess->sftp_eof_pending = false;
+        sshfwd_write_eof(sess->c);
+    }
+
+  out:
+    /* Let the connection layer reopen the window we've now drained */
+    if (consumed)
+        sshfwd_unthrottle(sess->c, bufchain_size(&sess->subsys_input));
+}
+
+static size_t sftp_chan_send(Channel *chan, bool is_stderr,
+                             const void *data, size_t length)
+{
+    sesschan *sess = container_of(chan, sesschan, chan);
+
+    bufchain_add(&sess->subsys_input, data, length);
+    queue_idempotent_callback(&sess->ic_sftp);
+
+    return bufchain_size(&sess->subsys_input);
+}
+
+static void sftp_chan_set_input_wanted(Channel *chan, bool wanted)
+{
+    sesschan *sess = container_of(chan, sesschan, chan);
+
+    sess->sftp_output_wanted = wanted;
+    if (wanted)
+        queue_idempotent_callback(&sess->ic_sftp);
 }
 
 static void sftp_chan_send_eof(Channel *chan)
 {
     sesschan *sess = container_of(chan, sesschan, chan);
-    sshfwd_write_eof(sess->c);
+    sess->sftp_eof_pending = true;
+    queue_idempotent_callback(&sess->ic_sftp);
 }
 
 static char *sftp_log_close_msg(Channel *chan)
@@ -1202,3 +1202,194 @@ void xfer_cleanup(struct fxp_xfer *xfer)
     }
     sfree(xfer);
 }
+
+/*
+ * A similar wrapper round fxp_readdir_*, which keeps several
+ * FXP_READDIR requests outstanding on the same directory handle. Each
+ * one returns the next batch of names, so reading a large directory
+ * over a slow link no longer costs a round trip per batch.
+ *
+ * We start with a small number of requests in flight, so that small
+ * directories don't provoke lots of pointless EOF responses, and
+ * double it every time a batch comes back non-empty.
+ */
+#define DIRREAD_INITIAL_WINDOW 2
+#define DIRREAD_MAX_WINDOW 32
+
+struct dirread_req {
+    struct fxp_names *names;           /* NULL for EOF or error */
+    const char *errmsg;
+    int errtype;
+    bool complete;
+    struct dirread_req *next;
+};
+
+struct fxp_dirread {
+    struct fxp_handle *dh;
+    int nreqs, window;
+    bool eof;               /* seen EOF or an error: send no more requests */
+    bool done;              /* reported EOF or an error to the caller */
+    bool broken;            /* lost the connection: don't wait for replies */
+    const char *errmsg;
+    int errtype;
+    struct dirread_req *head, *tail;
+};
+
+struct fxp_dirread *dirread_init(struct fxp_handle *dh)
+{
+    struct fxp_dirread *dr = snew(struct fxp_dirread);
+
+    dr->dh = dh;
+    dr->nreqs = 0;
+    dr->window = DIRREAD_INITIAL_WINDOW;
+    dr->eof = dr->done = dr->broken = false;
+    dr->errmsg = NULL;
+    dr->errtype = SSH_FX_OK;
+    dr->head = dr->tail = NULL;
+
+    return dr;
+}
+
+static void dirread_queue(struct fxp_dirread *dr)
+{
+    while (dr->nreqs < dr->window && !dr->eof) {
+        struct dirread_req *rr = snew(struct dirread_req);
+        struct sftp_request *req;
+
+        rr->names = NULL;
+        rr->complete = false;
+        rr->next = NULL;
+        if (dr->tail)
+            dr->tail->next = rr;
+        else
+            dr->head = rr;
+        dr->tail = rr;
+        dr->nreqs++;
+
+        sftp_register(req = fxp_readdir_send(dr->dh));
+        fxp_set_userdata(req, rr);
+    }
+}
+
+/*
+ * Receive one response to one of our outstanding requests. Returns
+ * false if we couldn't, in which case there's no point waiting for
+ * any more.
+ */
+static bool dirread_gotpkt(struct fxp_dirread *dr)
+{
+    struct sftp_packet *pktin = sftp_recv();
+    struct sftp_request *rreq;
+    struct dirread_req *rr;
+
+    rreq = sftp_find_request(pktin);
+    if (!rreq) {
+        if (pktin)
+            sftp_pkt_free(pktin);
+        return false;
+    }
+
+    for (rr = dr->head; rr; rr = rr->next)
+        if (rr == fxp_get_userdata(rreq))
+            break;
+    if (!rr || rr->complete) {
+        fxp_internal_error("request ID is not part of the current "
+                           "directory read");
+        sftp_pkt_free(pktin);
+        return false;
+    }
+
+    rr->names = fxp_readdir_recv(pktin, rreq);
+    if (rr->names && rr->names->nnames == 0) {
+        /*
+         * A successful response containing no names is unusual,
+         * but not forbidden, and there's nothing sensible to do
+         * with it except treat it as EOF.
+         */
+        fxp_free_names(rr->names);
+        rr->names = NULL;
+        fxp_errtype = SSH_FX_EOF;
+        fxp_error_message = "end of file";
+    }
+
+    if (rr->names) {
+        if (dr->window < DIRREAD_MAX_WINDOW)
+            dr->window *= 2;
+    } else {
+        rr->errtype = fxp_errtype;
+        rr->errmsg = fxp_error_message;
+        dr->eof = true;
+    }
+    rr->complete = true;
+    return true;
+}
+
+/*
+ * Return the next batch of names from the directory, waiting for it
+ * if necessary. At the end of the directory, or on error, returns
+ * NULL, with fxp_error_type() returning SSH_FX_EOF in the former case.
+ */
+struct fxp_names *dirread_next(struct fxp_dirread *dr)
+{
+    while (!dr->done) {
+        if (dr->head && dr->head->complete) {
+            struct dirread_req *rr = dr->head;
+            struct fxp_names *names = rr->names;
+
+            dr->head = rr->next;
+            if (!dr->head)
+                dr->tail = NULL;
+            dr->nreqs--;
+
+            if (!names) {
+                dr->errtype = rr->errtype;
+                dr->errmsg = rr->errmsg;
+                dr->done = true;
+            }
+            sfree(rr);
+            if (names)
+                return names;
+            break;
+        }
+
+        dirread_queue(dr);
+        if (!dirread_gotpkt(dr)) {
+            dr->errtype = fxp_errtype;
+            dr->errmsg = fxp_error_message;
+            dr->eof = dr->done = dr->broken = true;
+        }
+    }
+
+    fxp_errtype = dr->errtype;
+    fxp_error_message = dr->errmsg;
+    return NULL;
+}
+
+/*
+ * Collect the responses to any requests still outstanding, and free
+ * everything. This must be called before sending any other request
+ * (such as the FXP_CLOSE on the directory handle).
+ */
+void dirread_cleanup(struct fxp_dirread *dr)
+{
+    while (dr->head) {
+        struct dirread_req *rr = dr->head;
+
+        if (!rr->complete && !dr->broken && !dirread_gotpkt(dr))
+            dr->broken = true;
+        if (!rr->complete && !dr->broken)
+            continue;
+
+        dr->head = rr->next;
+        if (rr->names)
+            fxp_free_names(rr->names);
+        sfree(rr);
+    }
+    sfree(dr);
+}
+
+bool fxp_readdir_attrs_usable(const struct fxp_attrs *attrs)
+{
+    return ((attrs->flags & SSH_FILEXFER_ATTR_PERMISSIONS) &&
+            (attrs->permissions & 0170000) != 0120000);
+}
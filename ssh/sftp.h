@@ -312,6 +312,28 @@ bool xfer_done(struct fxp_xfer *xfer);
 void xfer_set_error(struct fxp_xfer *xfer);
 void xfer_cleanup(struct fxp_xfer *xfer);
 
+/*
+ * A wrapper to go round fxp_readdir_*, which keeps several
+ * FXP_READDIR requests outstanding at once. dirread_next returns each
+ * batch of names in turn, and NULL at the end of the directory (with
+ * fxp_error_type() == SSH_FX_EOF) or on error. dirread_cleanup must
+ * be called before sending any further requests.
+ */
+struct fxp_dirread;
+
+struct fxp_dirread *dirread_init(struct fxp_handle *dh);
+struct fxp_names *dirread_next(struct fxp_dirread *dr);
+void dirread_cleanup(struct fxp_dirread *dr);
+
+/*
+ * Decide whether the attributes returned alongside a name by
+ * FXP_READDIR can stand in for the result of FXP_STAT on that name,
+ * saving a round trip. They must include the file type, and must not
+ * describe a symlink, because servers generally report those as
+ * lstat would.
+ */
+bool fxp_readdir_attrs_usable(const struct fxp_attrs *attrs);
+
 /*
  * Vtable for the platform-specific filesystem implementation that
  * answers requests in an SFTP server.
@@ -186,6 +186,12 @@ struct ssh_sharing_connstate {
     tree234 *channels_by_us;       /* stores 'struct share_channel' */
     tree234 *channels_by_server;   /* stores 'struct share_channel' */
 
+    /* The channel most recently looked up by upstream id. Bulk
+     * traffic from the server tends to arrive in long runs for the
+     * same channel, so checking this first saves a tree search per
+     * packet in the common case. Cleared when the channel goes away. */
+    struct share_channel *last_chan_by_us;
+
     /* Another class of channel which doesn't have a downstream id.
      * The difference between these and halfchannels is that xchannels
      * do have an *upstream* id, because upstream has already accepted
@@ -202,6 +208,10 @@ struct ssh_sharing_connstate {
     /* Global requests we've sent on to the server, pending replies. */
     struct share_globreq *globreq_head, *globreq_tail;
 
+    /* Scratch buffer for assembling packets to send downstream,
+     * reused from one packet to the next. */
+    strbuf *outbuf;
+
     Plug plug;
 };
 
@@ -507,6 +517,7 @@ static void share_connstate_free(struct ssh_sharing_connstate *cs)
     if (cs->sock)
         sk_close(cs->sock);
 
+    strbuf_free(cs->outbuf);
     sfree(cs);
 }
 
@@ -601,9 +612,16 @@ static void share_channel_set_server_id(struct ssh_sharing_connstate *cs,
 static struct share_channel *share_find_channel_by_upstream(
     struct ssh_sharing_connstate *cs, unsigned upstream_id)
 {
-    struct share_channel dummychan;
+    struct share_channel dummychan, *chan;
+
+    if (cs->last_chan_by_us && cs->last_chan_by_us->upstream_id == upstream_id)
+        return cs->last_chan_by_us;
+
     dummychan.upstream_id = upstream_id;
-    return find234(cs->channels_by_us, &dummychan, NULL);
+    chan = find234(cs->channels_by_us, &dummychan, NULL);
+    if (chan)
+        cs->last_chan_by_us = chan;
+    return chan;
 }
 
 static struct share_channel *share_find_channel_by_server(
@@ -619,6 +637,8 @@ static void share_remove_channel(struct ssh_sharing_connstate *cs,
 {
     del234(cs->channels_by_us, chan);
     del234(cs->channels_by_server, chan);
+    if (cs->last_chan_by_us == chan)
+        cs->last_chan_by_us = NULL;
     if (chan->x11_auth_upstream)
         ssh_remove_sharing_x11_display(cs->parent->cl,
                                        chan->x11_auth_upstream);
@@ -730,11 +750,19 @@ static PRINTF_LIKE(2, 3) void log_general(struct ssh_sharing_state *sharestate,
     sfree(buf);
 }
 
+/*
+ * Send a packet to a downstream. If 'chan' is non-NULL, the packet is
+ * a channel message whose first uint32 field is the recipient channel
+ * id, and we substitute chan's downstream id for whatever is in the
+ * packet as we copy it into the output buffer. That way callers
+ * relaying a packet from the server don't have to make a rewritten
+ * copy of it first.
+ */
 static void send_packet_to_downstream(struct ssh_sharing_connstate *cs,
                                       int type, const void *pkt, int pktlen,
                                       struct share_channel *chan)
 {
-    strbuf *packet;
+    strbuf *packet = cs->outbuf;
 
     if (!cs->sock) /* throw away all packets destined for a dead downstream */
         return;
@@ -760,14 +788,15 @@ static void send_packet_to_downstream(struct ssh_sharing_connstate *cs,
         ptrlen data;
 
         BinarySource_BARE_INIT(src, pkt, pktlen);
-        channel = get_uint32(src);
+        get_uint32(src);               /* recipient id: replaced below */
         data = get_string(src);
+        channel = chan->downstream_id;
 
         do {
             int this_len = (data.len > chan->downstream_maxpkt ?
                             chan->downstream_maxpkt : data.len);
 
-            packet = strbuf_new_nm();
+            strbuf_clear(packet);
             put_uint32(packet, 0);     /* placeholder for length field */
             put_byte(packet, type);
             put_uint32(packet, channel);
@@ -777,19 +806,26 @@ static void send_packet_to_downstream(struct ssh_sharing_connstate *cs,
             data.len -= this_len;
             PUT_32BIT_MSB_FIRST(packet->s, packet->len-4);
             sk_write(cs->sock, packet->s, packet->len);
-            strbuf_free(packet);
         } while (data.len > 0);
     } else {
         /*
-         * Just do the obvious thing.
+         * Just do the obvious thing, plus the channel id substitution
+         * if we were asked for it.
          */
-        packet = strbuf_new_nm();
+        strbuf_clear(packet);
         put_uint32(packet, 0);     /* placeholder for length field */
         put_byte(packet, type);
         put_data(packet, pkt, pktlen);
+        if (chan && pktlen >= 4)
+            PUT_32BIT_MSB_FIRST(packet->s + 5, chan->downstream_id);
         PUT_32BIT_MSB_FIRST(packet->s, packet->len-4);
         sk_write(cs->sock, packet->s, packet->len);
+    }
+
+    /* Don't keep an outsized buffer around after a one-off big packet */
+    if (packet->len > 0x10000) {
         strbuf_free(packet);
+        cs->outbuf = strbuf_new_nm();
     }
 }
 
@@ -1046,8 +1082,6 @@ static void share_xchannel_confirmation(
         struct share_xchannel_message *msg = xc->msghead;
         xc->msghead = msg->next;
 
-        if (msg->datalen >= 4)
-            PUT_32BIT_MSB_FIRST(msg->data, chan->downstream_id);
         send_packet_to_downstream(cs, msg->type,
                                   msg->data, msg->datalen, chan);
 
@@ -1162,7 +1196,6 @@ void share_got_pkt_from_server(ssh_sharing_connstate *cs, int type,
 {
     const unsigned char *pkt = (const unsigned char *)vpkt;
     struct share_globreq *globreq;
-    size_t id_pos;
     unsigned upstream_id, server_id;
     struct share_channel *chan;
     struct share_xchannel *xc;
@@ -1226,17 +1259,14 @@ void share_got_pkt_from_server(ssh_sharing_connstate *cs, int type,
          * first uint32 field in the packet. Substitute the downstream
          * channel id for our one and pass the packet downstream.
          */
-        id_pos = src->pos;
         upstream_id = get_uint32(src);
         if ((chan = share_find_channel_by_upstream(cs, upstream_id)) != NULL) {
             /*
              * The normal case: this id refers to an open channel.
+             * send_packet_to_downstream does the id substitution as
+             * it copies the packet into its output buffer.
              */
-            unsigned char *rewritten = snewn(pktlen, unsigned char);
-            memcpy(rewritten, pkt, pktlen);
-            PUT_32BIT_MSB_FIRST(rewritten + id_pos, chan->downstream_id);
-            send_packet_to_downstream(cs, type, rewritten, pktlen, chan);
-            sfree(rewritten);
+            send_packet_to_downstream(cs, type, pkt, pktlen, chan);
 
             /*
              * Update the channel state, for messages that need it.
@@ -1950,7 +1980,9 @@ static int share_listen_accepting(Plug *plug,
     cs->xchannels_by_us = newtree234(share_xchannel_us_cmp);
     cs->xchannels_by_server = newtree234(share_xchannel_server_cmp);
     cs->forwardings = newtree234(share_forwarding_cmp);
+    cs->last_chan_by_us = NULL;
     cs->globreq_head = cs->globreq_tail = NULL;
+    cs->outbuf = strbuf_new_nm();
 
     peerinfo = sk_peer_info(cs->sock);
     log_downstream(cs, "connected%s%s",
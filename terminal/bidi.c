@@ -323,36 +323,7 @@ static const shape_node shapetypes[] = {
  */
 unsigned char bidi_getType(int ch)
 {
-    static const struct {
-        int first, last, type;
-    } lookup[] = {
-        #include "unicode/bidi_type.h"
-    };
-
-    int i, j, k;
-
-    i = -1;
-    j = lenof(lookup);
-
-    while (j - i > 1) {
-        k = (i + j) / 2;
-        if (ch < lookup[k].first)
-            j = k;
-        else if (ch > lookup[k].last)
-            i = k;
-        else
-            return lookup[k].type;
-    }
-
-    /*
-     * If we reach here, the character was not in any of the
-     * intervals listed in the lookup table. This means we return
-     * ON (`Other Neutrals'). This is the appropriate code for any
-     * character genuinely not listed in the Unicode table, and
-     * also the table above has deliberately left out any
-     * characters _explicitly_ listed as ON (to save space!).
-     */
-    return ON;
+    return unicode_props(ch)->bidi;
 }
 
 /*
@@ -376,6 +347,9 @@ static unsigned mirror_glyph(unsigned int ch)
 
     int i, j, k;
 
+    if (!(unicode_props(ch)->flags & UPROP_MIRRORED))
+        return ch;
+
     i = -1;
     j = lenof(mirror_pairs);
 
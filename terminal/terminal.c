@@ -93,7 +93,7 @@ static termline *lineptr(Terminal *, int, int);
 static void check_line_size(Terminal *, termline *);
 static void do_paint(Terminal *);
 static void erase_lots(Terminal *, bool, bool, bool);
-static int find_last_nonempty_line(Terminal *, tree234 *);
+static int find_last_nonempty_line(Terminal *, termscreen *);
 static void swap_screen(Terminal *, int, bool, bool);
 static void update_sbar(Terminal *);
 static void deselect(Terminal *);
@@ -130,6 +130,93 @@ static void freetermline(termline *line)
     }
 }
 
+static termscreen *newtermscreen(void)
+{
+    termscreen *scr = snew(termscreen);
+    scr->size = 16;
+    scr->lines = snewn(scr->size, termline *);
+    scr->start = scr->nlines = 0;
+    return scr;
+}
+
+static void freetermscreen(termscreen *scr)
+{
+    if (scr) {
+        for (int i = 0; i < scr->nlines; i++)
+            freetermline(scr->lines[(scr->start + i) & (scr->size - 1)]);
+        sfree(scr->lines);
+        sfree(scr);
+    }
+}
+
+static inline int count_screen(termscreen *scr)
+{
+    return scr->nlines;
+}
+
+/* Return a pointer to the slot holding a given line of the screen */
+static inline termline **screen_slot(termscreen *scr, int index)
+{
+    return &scr->lines[(scr->start + index) & (scr->size - 1)];
+}
+
+static inline termline *index_screen(termscreen *scr, int index)
+{
+    if (index < 0 || index >= scr->nlines)
+        return NULL;
+    return *screen_slot(scr, index);
+}
+
+/* Insert a line so that it becomes line 'index' of the screen */
+static void addpos_screen(termscreen *scr, termline *line, int index)
+{
+    assert(index >= 0 && index <= scr->nlines);
+
+    if (scr->nlines == scr->size) {
+        /* Out of room: unroll the ring into a buffer twice the size */
+        termline **newlines = snewn(scr->size * 2, termline *);
+        for (int i = 0; i < scr->nlines; i++)
+            newlines[i] = *screen_slot(scr, i);
+        sfree(scr->lines);
+        scr->lines = newlines;
+        scr->size *= 2;
+        scr->start = 0;
+    }
+
+    if (index < scr->nlines / 2) {
+        /* Move the lines above the insertion point up by one */
+        scr->start = (scr->start - 1) & (scr->size - 1);
+        for (int i = 0; i < index; i++)
+            *screen_slot(scr, i) = *screen_slot(scr, i + 1);
+    } else {
+        /* Move the lines below the insertion point down by one */
+        for (int i = scr->nlines; i > index; i--)
+            *screen_slot(scr, i) = *screen_slot(scr, i - 1);
+    }
+    *screen_slot(scr, index) = line;
+    scr->nlines++;
+}
+
+/* Remove and return line 'index' of the screen */
+static termline *delpos_screen(termscreen *scr, int index)
+{
+    if (index < 0 || index >= scr->nlines)
+        return NULL;
+
+    termline *line = *screen_slot(scr, index);
+
+    if (index < scr->nlines / 2) {
+        for (int i = index; i > 0; i--)
+            *screen_slot(scr, i) = *screen_slot(scr, i - 1);
+        scr->start = (scr->start + 1) & (scr->size - 1);
+    } else {
+        for (int i = index; i < scr->nlines - 1; i++)
+            *screen_slot(scr, i) = *screen_slot(scr, i + 1);
+    }
+    scr->nlines--;
+    return line;
+}
+
 void term_release_line(termline *line)
 {
     if (line->temporary)
@@ -400,6 +487,16 @@ static void move_termchar(termline *line, termchar *dest, termchar *src)
 #endif
 }
 
+static termline *duptermline(termline *oldline)
+{
+    termline *newline = snew(termline);
+    *newline = *oldline;               /* copy the POD structure fields */
+    newline->chars = snewn(newline->size, termchar);
+    for (int j = 0; j < newline->size; j++)
+        newline->chars[j] = oldline->chars[j];
+    return newline;
+}
+
 #ifndef NO_SCROLLBACK_COMPRESSION
 
 /*
@@ -1014,16 +1111,6 @@ static termline *decompressline_and_free(compressed_scrollback_line *cline)
 
 #else /* NO_SCROLLBACK_COMPRESSION */
 
-static termline *duptermline(termline *oldline)
-{
-    termline *newline = snew(termline);
-    *newline = *oldline;               /* copy the POD structure fields */
-    newline->chars = snewn(newline->size, termchar);
-    for (int j = 0; j < newline->size; j++)
-        newline->chars[j] = oldline->chars[j];
-    return newline;
-}
-
 typedef termline compressed_scrollback_line;
 
 static inline compressed_scrollback_line *compressline_and_free(
@@ -1060,6 +1147,101 @@ static inline void free_compressed_line(compressed_scrollback_line *line)
 
 #endif /* NO_SCROLLBACK_COMPRESSION */
 
+static void resizeline(Terminal *, termline *, int);
+
+#ifndef NO_SCROLLBACK_COMPRESSION
+
+/*
+ * Cache of recently retrieved scrollback lines, so that repainting
+ * a view of the scrollback, or dragging a selection around in it,
+ * doesn't have to decompress the same lines over and over again.
+ *
+ * The cache is direct-mapped, indexed by the address of the
+ * compressed line, and holds each line as a termline already widened
+ * to the terminal width it was last retrieved at. lineptr() hands
+ * out copies of the cached lines, so callers can hold on to them and
+ * free them with unlineptr() exactly as before. Whenever a compressed
+ * line is freed, its cache entry must be dropped with
+ * sbcache_forget(), in case the same address is reused.
+ */
+#define SBCACHE_SIZE 128
+
+struct sbcache_entry {
+    compressed_scrollback_line *cline;
+    termline *line;
+};
+
+static struct sbcache_entry *sbcache_slot(
+    Terminal *term, compressed_scrollback_line *cline)
+{
+    uintptr_t h = (uintptr_t)cline;
+
+    if (!term->sbcache) {
+        term->sbcache = snewn(SBCACHE_SIZE, struct sbcache_entry);
+        memset(term->sbcache, 0, SBCACHE_SIZE * sizeof(*term->sbcache));
+    }
+
+    /* Heap addresses are aligned, so the lowest bits aren't useful */
+    h = (h >> 4) ^ (h >> 11);
+    return &term->sbcache[h % SBCACHE_SIZE];
+}
+
+static void sbcache_forget(Terminal *term, compressed_scrollback_line *cline)
+{
+    if (term->sbcache) {
+        struct sbcache_entry *ent = sbcache_slot(term, cline);
+        if (ent->cline == cline) {
+            freetermline(ent->line);
+            ent->cline = NULL;
+            ent->line = NULL;
+        }
+    }
+}
+
+static void sbcache_clear(Terminal *term)
+{
+    if (term->sbcache) {
+        for (size_t i = 0; i < SBCACHE_SIZE; i++)
+            freetermline(term->sbcache[i].line);
+        sfree(term->sbcache);
+        term->sbcache = NULL;
+    }
+}
+
+static termline *sbcache_get(Terminal *term, compressed_scrollback_line *cline)
+{
+    struct sbcache_entry *ent = sbcache_slot(term, cline);
+    termline *line;
+
+    if (ent->cline != cline) {
+        freetermline(ent->line);
+        ent->cline = cline;
+        ent->line = decompressline_no_free(cline);
+        ent->line->temporary = false;
+    }
+
+    /* See the comment in lineptr() about only ever widening lines */
+    if (term->cols > ent->line->cols)
+        resizeline(term, ent->line, term->cols);
+
+    line = duptermline(ent->line);
+    line->temporary = true;
+    return line;
+}
+
+#else /* NO_SCROLLBACK_COMPRESSION */
+
+static inline void sbcache_forget(
+    Terminal *term, compressed_scrollback_line *cline) {}
+static inline void sbcache_clear(Terminal *term) {}
+static inline termline *sbcache_get(
+    Terminal *term, compressed_scrollback_line *cline)
+{
+    return decompressline_no_free(cline);
+}
+
+#endif /* NO_SCROLLBACK_COMPRESSION */
+
 /*
  * Resize a line to make it `cols' columns wide.
  */
@@ -1151,7 +1333,7 @@ static int sblines(Terminal *term)
 }
 
 static void null_line_error(Terminal *term, int y, int lineno,
-                            tree234 *whichtree, int treeindex,
+                            void *whichtree, int treeindex,
                             const char *varname)
 {
     modalfatalbox("%s==NULL in terminal.c\n"
@@ -1165,8 +1347,8 @@ static void null_line_error(Terminal *term, int y, int lineno,
                   "and pass on the above information.",
                   varname, lineno, y, term->cols, term->rows,
                   term->scrollback, count234(term->scrollback),
-                  term->screen, count234(term->screen),
-                  term->alt_screen, count234(term->alt_screen),
+                  term->screen, count_screen(term->screen),
+                  term->alt_screen, count_screen(term->alt_screen),
                   term->alt_sblines, whichtree, treeindex, commitid);
 }
 
@@ -1185,11 +1367,11 @@ static inline int checkscr(int y, int lineno)
 static termline *lineptr(Terminal *term, int y, int lineno)
 {
     termline *line;
-    tree234 *whichtree;
+    termscreen *whichscreen = NULL;
     int treeindex;
 
     if (y >= 0) {
-        whichtree = term->screen;
+        whichscreen = term->screen;
         treeindex = y;
     } else {
         int altlines = 0;
@@ -1199,26 +1381,27 @@ static termline *lineptr(Terminal *term, int y, int lineno)
             altlines = term->alt_sblines;
         }
         if (y < -altlines) {
-            whichtree = term->scrollback;
             treeindex = y + altlines + count234(term->scrollback);
         } else {
-            whichtree = term->alt_screen;
+            whichscreen = term->alt_screen;
             treeindex = y + term->alt_sblines;
-            /* treeindex = y + count234(term->alt_screen); */
+            /* treeindex = y + count_screen(term->alt_screen); */
         }
     }
-    if (whichtree == term->scrollback) {
-        compressed_scrollback_line *cline = index234(whichtree, treeindex);
+    if (!whichscreen) {
+        compressed_scrollback_line *cline =
+            index234(term->scrollback, treeindex);
         if (!cline)
-            null_line_error(term, y, lineno, whichtree, treeindex, "cline");
-        line = decompressline_no_free(cline);
+            null_line_error(term, y, lineno, term->scrollback, treeindex,
+                            "cline");
+        line = sbcache_get(term, cline);
     } else {
-        line = index234(whichtree, treeindex);
+        line = index_screen(whichscreen, treeindex);
     }
 
     /* We assume that we don't screw up and retrieve something out of range. */
     if (line == NULL)
-        null_line_error(term, y, lineno, whichtree, treeindex, "line");
+        null_line_error(term, y, lineno, whichscreen, treeindex, "line");
     assert(line != NULL);
 
     /*
@@ -1287,6 +1470,7 @@ static void check_line_size(Terminal *term, termline *line)
 static void term_schedule_tblink(Terminal *term);
 static void term_schedule_cblink(Terminal *term);
 static void term_update_callback(void *ctx);
+static void term_paste_callback(void *vterm);
 
 static void term_timer(void *ctx, unsigned long now)
 {
@@ -1316,6 +1500,9 @@ static void term_timer(void *ctx, unsigned long now)
         term->window_update_cooldown = false;
     }
 
+    if (term->paste_throttled && now == term->next_paste)
+        term_paste_callback(term);
+
     if (term->window_update_pending)
         term_update_callback(term);
 }
@@ -1665,6 +1852,7 @@ static void term_copy_stuff_from_conf(Terminal *term)
     term->no_remote_wintitle = conf_get_bool(term->conf, CONF_no_remote_wintitle);
     term->no_remote_clearscroll = conf_get_bool(term->conf, CONF_no_remote_clearscroll);
     term->rawcnp = conf_get_bool(term->conf, CONF_rawcnp);
+    term->rtf_paste = conf_get_bool(term->conf, CONF_rtf_paste);
     term->utf8linedraw = conf_get_bool(term->conf, CONF_utf8linedraw);
     term->rect_select = conf_get_bool(term->conf, CONF_rect_select);
     term->remote_qtitle_action = conf_get_int(term->conf, CONF_remote_qtitle_action);
@@ -1855,6 +2043,7 @@ void term_clrsb(Terminal *term)
     while ((line = delpos234(term->scrollback, 0)) != NULL) {
         sfree(line);            /* this is compressed data, not a termline */
     }
+    sbcache_clear(term);
 
     /*
      * When clearing the scrollback, we also truncate any termlines on
@@ -2103,19 +2292,15 @@ Terminal *term_init(Conf *myconf, struct unicode_data *ucsdata, TermWin *win)
 void term_free(Terminal *term)
 {
     compressed_scrollback_line *cline;
-    termline *line;
     struct beeptime *beep;
     int i;
 
     while ((cline = delpos234(term->scrollback, 0)) != NULL)
         free_compressed_line(cline);
     freetree234(term->scrollback);
-    while ((line = delpos234(term->screen, 0)) != NULL)
-        freetermline(line);
-    freetree234(term->screen);
-    while ((line = delpos234(term->alt_screen, 0)) != NULL)
-        freetermline(line);
-    freetree234(term->alt_screen);
+    sbcache_clear(term);
+    freetermscreen(term->screen);
+    freetermscreen(term->alt_screen);
     if (term->disptext) {
         for (i = 0; i < term->rows; i++)
             freetermline(term->disptext[i]);
@@ -2180,7 +2365,7 @@ void term_get_cursor_position(Terminal *term, int *x, int *y)
  */
 void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
 {
-    tree234 *newalt;
+    termscreen *newalt;
     termline **newdisp, *line;
     int i, j, oldrows = term->rows;
     int sblen;
@@ -2203,7 +2388,7 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
 
     if (term->rows == -1) {
         term->scrollback = newtree234(NULL);
-        term->screen = newtree234(NULL);
+        term->screen = newtermscreen();
         term->tempsblines = 0;
         term->rows = 0;
     }
@@ -2229,17 +2414,18 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
      */
     sblen = count234(term->scrollback);
     /* Do this loop to expand the screen if newrows > rows */
-    assert(term->rows == count234(term->screen));
+    assert(term->rows == count_screen(term->screen));
     while (term->rows < newrows) {
         if (term->tempsblines > 0) {
             compressed_scrollback_line *cline;
             /* Insert a line from the scrollback at the top of the screen. */
             assert(sblen >= term->tempsblines);
             cline = delpos234(term->scrollback, --sblen);
+            sbcache_forget(term, cline);
             line = decompressline_and_free(cline);
             line->temporary = false;   /* reconstituted line is now real */
             term->tempsblines -= 1;
-            addpos234(term->screen, line, 0);
+            addpos_screen(term->screen, line, 0);
             term->curs.y += 1;
             term->savecurs.y += 1;
             term->alt_y += 1;
@@ -2247,7 +2433,7 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
         } else {
             /* Add a new blank line at the bottom of the screen. */
             line = newtermline(term, newcols, false);
-            addpos234(term->screen, line, count234(term->screen));
+            addpos_screen(term->screen, line, count_screen(term->screen));
         }
         term->rows += 1;
     }
@@ -2255,11 +2441,11 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     while (term->rows > newrows) {
         if (term->curs.y < term->rows - 1) {
             /* delete bottom row, unless it contains the cursor */
-            line = delpos234(term->screen, term->rows - 1);
+            line = delpos_screen(term->screen, term->rows - 1);
             freetermline(line);
         } else {
             /* push top row to scrollback */
-            line = delpos234(term->screen, 0);
+            line = delpos_screen(term->screen, 0);
             addpos234(term->scrollback, compressline_and_free(line), sblen++);
             term->tempsblines += 1;
             term->curs.y -= 1;
@@ -2270,12 +2456,13 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
         term->rows -= 1;
     }
     assert(term->rows == newrows);
-    assert(count234(term->screen) == newrows);
+    assert(count_screen(term->screen) == newrows);
 
     /* Delete any excess lines from the scrollback. */
     while (sblen > newsavelines) {
-        line = delpos234(term->scrollback, 0);
-        sfree(line);
+        compressed_scrollback_line *cline = delpos234(term->scrollback, 0);
+        sbcache_forget(term, cline);
+        free_compressed_line(cline);
         sblen--;
     }
     if (sblen < term->tempsblines)
@@ -2300,16 +2487,12 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     term->dispcursx = term->dispcursy = -1;
 
     /* Make a new alternate screen. */
-    newalt = newtree234(NULL);
+    newalt = newtermscreen();
     for (i = 0; i < newrows; i++) {
         line = newtermline(term, newcols, true);
-        addpos234(newalt, line, i);
-    }
-    if (term->alt_screen) {
-        while (NULL != (line = delpos234(term->alt_screen, 0)))
-            freetermline(line);
-        freetree234(term->alt_screen);
+        addpos_screen(newalt, line, i);
     }
+    freetermscreen(term->alt_screen);
     term->alt_screen = newalt;
     term->alt_sblines = 0;
 
@@ -2384,11 +2567,11 @@ void term_provide_backend(Terminal *term, Backend *backend)
  * If only the top line has content, returns 0.
  * If no lines have content, return -1.
  */
-static int find_last_nonempty_line(Terminal *term, tree234 *screen)
+static int find_last_nonempty_line(Terminal *term, termscreen *screen)
 {
     int i;
-    for (i = count234(screen) - 1; i >= 0; i--) {
-        termline *line = index234(screen, i);
+    for (i = count_screen(screen) - 1; i >= 0; i--) {
+        termline *line = index_screen(screen, i);
         int j;
         for (j = 0; j < line->cols; j++)
             if (!termchars_equal(&line->chars[j], &term->erase_char))
@@ -2412,7 +2595,7 @@ static void swap_screen(Terminal *term, int which,
     bool bt;
     pos tp;
     truecolour ttc;
-    tree234 *ttr;
+    termscreen *ttr;
 
     if (!which)
         reset = false;                 /* do no weird resetting if which==0 */
@@ -2604,10 +2787,10 @@ static void scroll(Terminal *term, int topline, int botline,
         if (lines > scrollwinsize)
             lines = scrollwinsize;
         while (lines-- > 0) {
-            line = delpos234(term->screen, botline);
+            line = delpos_screen(term->screen, botline);
             resizeline(term, line, term->cols);
             clear_line(term, line);
-            addpos234(term->screen, line, topline);
+            addpos_screen(term->screen, line, topline);
 
             if (term->selstart.y >= topline && term->selstart.y <= botline) {
                 term->selstart.y++;
@@ -2628,7 +2811,7 @@ static void scroll(Terminal *term, int topline, int botline,
         if (lines > scrollwinsize)
             lines = scrollwinsize;
         while (lines-- > 0) {
-            line = delpos234(term->screen, topline);
+            line = delpos_screen(term->screen, topline);
 #ifdef TERM_CC_DIAGS
             cc_check(line);
 #endif
@@ -2644,6 +2827,7 @@ static void scroll(Terminal *term, int topline, int botline,
 
                     sblen--;
                     cline = delpos234(term->scrollback, 0);
+                    sbcache_forget(term, cline);
                     free_compressed_line(cline);
                 } else
                     term->tempsblines += 1;
@@ -2678,7 +2862,7 @@ static void scroll(Terminal *term, int topline, int botline,
             resizeline(term, line, term->cols);
             clear_line(term, line);
             line->trusted = false;
-            addpos234(term->screen, line, botline);
+            addpos_screen(term->screen, line, botline);
 
             /*
              * If the selection endpoints move into the scrollback,
@@ -3572,6 +3756,41 @@ static inline void term_keyinput_internal(
     term_seen_key_event(term);
 }
 
+/*
+ * Vet a code point decoded from UTF-8 (with a minimal encoding) in
+ * the terminal's input, and translate it into what we actually want
+ * to display, or one of the UCS* special values.
+ */
+static unsigned long term_translate_utf8_char(unsigned long t)
+{
+    /* Unicode line separator and paragraph separator are CR-LF */
+    if (t == 0x2028 || t == 0x2029)
+        return 0x85;
+
+    /* High controls are probably a Baaad idea too. */
+    if (t < 0xA0)
+        return 0xFFFD;
+
+    /* The UTF-16 surrogates are not nice either. */
+    /*       The standard give the option of decoding these:
+     *       I don't want to! */
+    if (t >= 0xD800 && t < 0xE000)
+        return UCSINVALID;
+
+    /* ISO 10646 characters now limited to UTF-16 range. */
+    if (t > 0x10FFFF)
+        return UCSINVALID;
+
+    /* U+FEFF is best seen as a null. */
+    if (t == 0xFEFF)
+        return UCSINCOMPLETE;
+    /* But U+FFFE is an error. */
+    if (t == 0xFFFE || t == 0xFFFF)
+        return UCSINVALID;
+
+    return t;
+}
+
 unsigned long term_translate(
     Terminal *term, struct term_utf8_decode *utf8, unsigned char c)
 {
@@ -3632,32 +3851,7 @@ unsigned long term_translate(
                 (t < 0x4000000 && utf8->size >= 5))
                 return UCSINVALID;
 
-            /* Unicode line separator and paragraph separator are CR-LF */
-            if (t == 0x2028 || t == 0x2029)
-                return 0x85;
-
-            /* High controls are probably a Baaad idea too. */
-            if (t < 0xA0)
-                return 0xFFFD;
-
-            /* The UTF-16 surrogates are not nice either. */
-            /*       The standard give the option of decoding these:
-             *       I don't want to! */
-            if (t >= 0xD800 && t < 0xE000)
-                return UCSINVALID;
-
-            /* ISO 10646 characters now limited to UTF-16 range. */
-            if (t > 0x10FFFF)
-                return UCSINVALID;
-
-            /* U+FEFF is best seen as a null. */
-            if (t == 0xFEFF)
-                return UCSINCOMPLETE;
-            /* But U+FFFE is an error. */
-            if (t == 0xFFFE || t == 0xFFFF)
-                return UCSINVALID;
-
-            return t;
+            return term_translate_utf8_char(t);
         }
     } else if (term->sco_acs &&
                (c!='\033' && c!='\012' && c!='\015' && c!='\b')) {
@@ -3713,6 +3907,7 @@ static void term_out(Terminal *term, bool called_from_term_data)
     int unget;
     const unsigned char *chars;
     size_t nchars_got = 0, nchars_used = 0;
+    bool decoded_utf8 = false;
 
     /*
      * During drag-selects, we do not process terminal input, because
@@ -3784,6 +3979,23 @@ static void term_out(Terminal *term, bool called_from_term_data)
              */
             if (term->logtype == LGTYP_DEBUG && term->logctx)
                 logtraffic(term->logctx, (unsigned char) c, LGTYP_DEBUG);
+            else if (c >= 0xC0 && term->termstate == TOPLEVEL &&
+                     !term->printing && in_utf(term) &&
+                     term->utf8.state == 0) {
+                /*
+                 * If this byte starts a complete and valid UTF-8
+                 * sequence, decode all of it now, rather than going
+                 * round this loop once for each byte of it.
+                 */
+                const char *p = (const char *)chars + nchars_used - 1;
+                size_t len = nchars_got - nchars_used + 1;
+                unsigned wc;
+                if (decode_utf8_run(&p, &len, &wc, 1)) {
+                    nchars_used = nchars_got - len;
+                    c = wc;
+                    decoded_utf8 = true;
+                }
+            }
         }
 
         /* Note only VT220+ are 8-bit VT102 is seven bit, it shouldn't even
@@ -3824,7 +4036,13 @@ static void term_out(Terminal *term, bool called_from_term_data)
         }
 
         /* Do character-set translation. */
-        if (term->termstate == TOPLEVEL) {
+        if (decoded_utf8) {
+            unsigned long t = term_translate_utf8_char(c);
+            decoded_utf8 = false;
+            if (t == UCSINCOMPLETE)
+                continue;
+            c = (t == UCSINVALID ? UCSERR : t);
+        } else if (term->termstate == TOPLEVEL) {
             unsigned long t = term_translate(term, &term->utf8, c);
             switch (t) {
               case UCSINCOMPLETE:
@@ -5996,10 +6214,29 @@ static termchar *term_bidi_line(Terminal *term, struct termline *ldata,
     return lchars;
 }
 
+/*
+ * Attribute bits that make no visible difference to a blank cell, as
+ * long as nothing is drawn in its foreground colour. do_paint ignores
+ * them when deciding whether a space can join the text run next to
+ * it.
+ */
+#define ATTR_BLANK_INSENSITIVE (ATTR_FGMASK | ATTR_BOLD | ATTR_DIM)
+#define ATTR_BLANK_SENSITIVE (ATTR_REVERSE | ATTR_UNDER | ATTR_STRIKE | \
+                              TATTR_ACTCURS | TATTR_PASCURS)
+
+/*
+ * The largest number of unchanged cells do_paint will redraw in the
+ * middle of a run, to save splitting it into two calls to
+ * win_draw_text.
+ */
+#define PAINT_MAX_CLEAN_GAP 8
+
 static void do_paint_draw(Terminal *term, termline *ldata, int x, int y,
                           wchar_t *ch, int ccount,
                           unsigned long attr, truecolour tc)
 {
+    term->paint_draw_calls++;
+
     if (ch[0] == TRUST_SIGIL_CHAR) {
         assert(ldata->trusted);
         assert(ccount == 1);
@@ -6038,6 +6275,8 @@ static void do_paint(Terminal *term)
 
     newline = snewn(term->cols, termchar);
 
+    term->paint_draw_calls = 0;
+
     rv = (!term->rvideo ^ !term->in_vbell ? ATTR_REVERSE : 0);
 
     /* Depends on:
@@ -6119,6 +6358,8 @@ static void do_paint(Terminal *term)
         int start = 0;
         int ccount = 0;
         bool last_run_dirty = false;
+        bool run_blank = false;
+        int clean_cells = 0, clean_start = 0, clean_ccount = 0;
         int laststart;
         bool dirtyrect;
         int *backward;
@@ -6280,7 +6521,8 @@ static void do_paint(Terminal *term)
         tc = term->erase_char.truecolour;
         for (j = 0; j < term->cols; j++) {
             unsigned long tattr, tchar;
-            bool break_run, do_copy, next_run_dirty = false;
+            bool break_run, do_copy, blank, next_run_dirty = false;
+            bool cell_changed = false;
             termchar *d = lchars + j;
 
             tattr = newline[j].attr;
@@ -6289,10 +6531,26 @@ static void do_paint(Terminal *term)
             if ((term->disptext[i]->chars[j].attr ^ tattr) & ATTR_WIDE)
                 dirty_line = true;
 
-            break_run = ((tattr ^ attr) & term->attr_mask) != 0;
-
-            if (!truecolour_equal(newline[j].truecolour, tc))
-                break_run = true;
+            /*
+             * A space only shows its background colour, so if either
+             * it or the whole run so far is blank, differences in the
+             * foreground attributes needn't break the run. (Colourful
+             * full-screen applications tend to recolour the spaces
+             * between words, and would otherwise cost a draw call
+             * apiece.)
+             */
+            blank = (tchar == ' ' && !(tattr & ATTR_BLANK_SENSITIVE));
+            if ((blank || run_blank) && ccount > 0 &&
+                !((tattr | attr) & ATTR_BLANK_SENSITIVE)) {
+                break_run = ((tattr ^ attr) & term->attr_mask &
+                             ~ATTR_BLANK_INSENSITIVE) != 0;
+                if (!optionalrgb_equal(newline[j].truecolour.bg, tc.bg))
+                    break_run = true;
+            } else {
+                break_run = ((tattr ^ attr) & term->attr_mask) != 0;
+                if (!truecolour_equal(newline[j].truecolour, tc))
+                    break_run = true;
+            }
 
 #ifdef USES_VTLINE_HACK
             /* Special hack for VT100 Linedraw glyphs */
@@ -6351,13 +6609,33 @@ static void do_paint(Terminal *term)
                 if (term->disptext[i]->chars[j].chr == tchar &&
                     (term->disptext[i]->chars[j].attr &~ DATTR_MASK)==tattr &&
                     truecolour_equal(
-                        term->disptext[i]->chars[j].truecolour, tc))
-                    break_run = true;
-                else if (!dirty_run && ccount == 1)
+                        term->disptext[i]->chars[j].truecolour,
+                        newline[j].truecolour)) {
+                    /*
+                     * This cell hasn't changed. Normally that ends the
+                     * run, but if we're in the middle of redrawing a
+                     * run anyway, tentatively carry on through a few
+                     * unchanged cells in case another changed one
+                     * follows. If none does, the unchanged tail is
+                     * trimmed off again before drawing.
+                     */
+                    if (!break_run && dirty_run && ccount > 0 &&
+                        clean_cells < PAINT_MAX_CLEAN_GAP) {
+                        if (clean_cells == 0) {
+                            clean_start = j;
+                            clean_ccount = ccount;
+                        }
+                        clean_cells++;
+                    } else {
+                        break_run = true;
+                    }
+                } else if (!dirty_run && ccount == 1)
                     break_run = true;
             }
 
             if (break_run) {
+                if (clean_cells)
+                    ccount = clean_ccount;
                 if ((dirty_run || last_run_dirty) && ccount > 0)
                     do_paint_draw(term, ldata, start, i, ch, ccount, attr, tc);
                 start = j;
@@ -6368,6 +6646,17 @@ static void do_paint(Terminal *term)
                 if (term->ucsdata->dbcs_screenfont)
                     last_run_dirty = dirty_run;
                 dirty_run = dirty_line || next_run_dirty;
+                run_blank = blank;
+                clean_cells = 0;
+            } else if (!blank) {
+                if (run_blank) {
+                    /* The run so far was all spaces, so it can take on
+                     * this character's foreground attributes. */
+                    attr = (attr & ~ATTR_BLANK_INSENSITIVE) |
+                        (tattr & ATTR_BLANK_INSENSITIVE);
+                    tc.fg = newline[j].truecolour.fg;
+                }
+                run_blank = false;
             }
 
             do_copy = false;
@@ -6375,6 +6664,7 @@ static void do_paint(Terminal *term)
                                           d, tchar, tattr)) {
                 do_copy = true;
                 dirty_run = true;
+                cell_changed = true;
             }
 
             sgrowarrayn(ch, chlen, ccount, 2);
@@ -6426,7 +6716,7 @@ static void do_paint(Terminal *term)
                 copy_termchar(term->disptext[i], j, d);
                 term->disptext[i]->chars[j].chr = tchar;
                 term->disptext[i]->chars[j].attr = tattr;
-                term->disptext[i]->chars[j].truecolour = tc;
+                term->disptext[i]->chars[j].truecolour = newline[j].truecolour;
                 if (start == j)
                     term->disptext[i]->chars[j].attr |= DATTR_STARTRUN;
             }
@@ -6441,12 +6731,26 @@ static void do_paint(Terminal *term)
                      * Ever.
                      */
                     assert(!(i == our_curs_y && j == our_curs_x));
-                    if (!termchars_equal(&term->disptext[i]->chars[j], d))
+                    if (!termchars_equal(&term->disptext[i]->chars[j], d)) {
                         dirty_run = true;
+                        cell_changed = true;
+                    }
                     copy_termchar(term->disptext[i], j, d);
                 }
             }
 
+            /*
+             * If a changed cell has turned up after some unchanged
+             * ones, we're committed to redrawing those too, and they
+             * no longer start runs of their own.
+             */
+            if (cell_changed && clean_cells) {
+                int k;
+                for (k = clean_start; k < j; k++)
+                    term->disptext[i]->chars[k].attr &= ~DATTR_STARTRUN;
+                clean_cells = 0;
+            }
+
             /* If it's a regional indicator letter, and so is the next
              * one, then also step to the next one, keeping the flag
              * sequence together. */
@@ -6485,6 +6789,8 @@ static void do_paint(Terminal *term)
                     term->disptext[i]->chars[j-1].attr & ~DATTR_STARTRUN;
             }
         }
+        if (clean_cells)
+            ccount = clean_ccount;
         if (dirty_run && ccount > 0)
             do_paint_draw(term, ldata, start, i, ch, ccount, attr, tc);
 
@@ -6583,7 +6889,11 @@ void term_scroll_to_selection(Terminal *term, int which_end)
 }
 
 /*
- * Helper routine for clipme(): growing buffer.
+ * Helper routines for clipme(): a buffer which either grows to hold
+ * all the text, or, if 'out' is set, is emptied into 'out' as UTF-8
+ * whenever it fills up.
+ *
+ * attrbuf and tcbuf may be NULL, if the caller doesn't need them.
  */
 typedef struct {
     size_t bufsize;         /* amount of allocated space in textbuf/attrbuf */
@@ -6594,38 +6904,89 @@ typedef struct {
     int *attrptr;           /* = attrbuf + bufpos */
     truecolour *tcbuf;      /* buffer for copied colours */
     truecolour *tcptr;      /* = tcbuf + bufpos */
+    BinarySink *out;        /* if non-NULL, where to flush the text to */
+    strbuf *utf8;           /* scratch space for clip_flush */
 } clip_workbuf;
 
+static void clip_workbuf_init(clip_workbuf *b, size_t size, bool want_attrs)
+{
+    memset(b, 0, sizeof(*b));
+    b->bufsize = size;
+    b->textptr = b->textbuf = snewn(b->bufsize, wchar_t);
+    if (want_attrs) {
+        b->attrptr = b->attrbuf = snewn(b->bufsize, int);
+        b->tcptr = b->tcbuf = snewn(b->bufsize, truecolour);
+    }
+}
+
+/*
+ * Write out the text in a streaming clip_workbuf as UTF-8. Unless
+ * this is the final flush, a trailing high surrogate is kept back,
+ * in case its partner is the next thing to arrive.
+ */
+static void clip_flush(clip_workbuf *b, bool final)
+{
+    size_t i = 0, n = b->bufpos;
+
+    if (!final && n > 0 && IS_HIGH_SURROGATE(b->textbuf[n-1]))
+        n--;
+
+    strbuf_clear(b->utf8);
+    while (i < n) {
+        unsigned long ch = b->textbuf[i++];
+        if (sizeof(wchar_t) == 2 && IS_HIGH_SURROGATE(ch) && i < n &&
+            IS_LOW_SURROGATE(b->textbuf[i])) {
+            ch = FROM_SURROGATES(ch, b->textbuf[i]);
+            i++;
+        } else if (IS_SURROGATE(ch)) {
+            ch = 0xfffd; /* illegal UTF-16 -> REPLACEMENT CHARACTER */
+        }
+        put_utf8_char(b->utf8, ch);
+    }
+    put_datapl(b->out, ptrlen_from_strbuf(b->utf8));
+
+    memmove(b->textbuf, b->textbuf + n, (b->bufpos - n) * sizeof(wchar_t));
+    b->bufpos -= n;
+    b->textptr = b->textbuf + b->bufpos;
+}
+
 static void clip_addchar(clip_workbuf *b, wchar_t chr, int attr, truecolour tc)
 {
     if (b->bufpos >= b->bufsize) {
-        sgrowarray(b->textbuf, b->bufsize, b->bufpos);
-        b->textptr = b->textbuf + b->bufpos;
-        b->attrbuf = sresize(b->attrbuf, b->bufsize, int);
-        b->attrptr = b->attrbuf + b->bufpos;
-        b->tcbuf = sresize(b->tcbuf, b->bufsize, truecolour);
-        b->tcptr = b->tcbuf + b->bufpos;
+        if (b->out) {
+            clip_flush(b, false);
+        } else {
+            sgrowarray(b->textbuf, b->bufsize, b->bufpos);
+            b->textptr = b->textbuf + b->bufpos;
+            if (b->attrbuf) {
+                b->attrbuf = sresize(b->attrbuf, b->bufsize, int);
+                b->attrptr = b->attrbuf + b->bufpos;
+                b->tcbuf = sresize(b->tcbuf, b->bufsize, truecolour);
+                b->tcptr = b->tcbuf + b->bufpos;
+            }
+        }
     }
     *b->textptr++ = chr;
-    *b->attrptr++ = attr;
-    *b->tcptr++ = tc;
+    if (b->attrbuf) {
+        *b->attrptr++ = attr;
+        *b->tcptr++ = tc;
+    }
     b->bufpos++;
 }
 
-static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
-                   const int *clipboards, int n_clipboards)
+/*
+ * Extract the text between two positions, feeding it a character at
+ * a time to a clip_workbuf. Only one line of the screen or scrollback
+ * is decompressed at a time, so if the workbuf is a streaming one,
+ * the memory used is bounded no matter how much text there is.
+ */
+static void clip_extract(Terminal *term, clip_workbuf *buf,
+                         pos top, pos bottom, bool rect)
 {
-    clip_workbuf buf;
     int old_top_x;
     int attr;
     truecolour tc;
 
-    buf.bufsize = 5120;
-    buf.bufpos = 0;
-    buf.textptr = buf.textbuf = snewn(buf.bufsize, wchar_t);
-    buf.attrptr = buf.attrbuf = snewn(buf.bufsize, int);
-    buf.tcptr = buf.tcbuf = snewn(buf.bufsize, truecolour);
-
     old_top_x = top.x;                 /* needed for rect==1 */
 
     while (poslt(top, bottom)) {
@@ -6755,7 +7116,7 @@ static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
                 }
 
                 for (p = cbuf; *p; p++)
-                    clip_addchar(&buf, *p, attr, tc);
+                    clip_addchar(buf, *p, attr, tc);
 
                 if (ldata->chars[x].cc_next)
                     x += ldata->chars[x].cc_next;
@@ -6767,13 +7128,31 @@ static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
         if (nl) {
             int i;
             for (i = 0; i < sel_nl_sz; i++)
-                clip_addchar(&buf, sel_nl[i], 0, term->basic_erase_char.truecolour);
+                clip_addchar(buf, sel_nl[i], 0,
+                             term->basic_erase_char.truecolour);
         }
         top.y++;
         top.x = rect ? old_top_x : 0;
 
         unlineptr(ldata);
     }
+}
+
+static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
+                   const int *clipboards, int n_clipboards)
+{
+    clip_workbuf buf;
+
+    /*
+     * The per-character attributes and colours are only used by
+     * front ends that can paste rich text. They take several times
+     * as much memory as the text itself, so don't collect them
+     * unless they're wanted.
+     */
+    clip_workbuf_init(&buf, 5120, term->rtf_paste);
+
+    clip_extract(term, &buf, top, bottom, rect);
+
 #if SELECTION_NUL_TERMINATED
     clip_addchar(&buf, 0, 0, term->basic_erase_char.truecolour);
 #endif
@@ -6810,7 +7189,7 @@ void term_copyall(Terminal *term, const int *clipboards, int n_clipboards)
 {
     pos top;
     pos bottom;
-    tree234 *screen = term->screen;
+    termscreen *screen = term->screen;
     top.y = -sblines(term);
     top.x = 0;
     bottom.y = find_last_nonempty_line(term, screen);
@@ -6818,6 +7197,31 @@ void term_copyall(Terminal *term, const int *clipboards, int n_clipboards)
     clipme(term, top, bottom, false, true, clipboards, n_clipboards);
 }
 
+/*
+ * Write the same text that term_copyall would copy - the whole of
+ * the scrollback and screen - to a BinarySink, in UTF-8, a chunk at
+ * a time.
+ */
+void term_save_scrollback(Terminal *term, BinarySink *bs)
+{
+    clip_workbuf buf;
+    pos top, bottom;
+
+    clip_workbuf_init(&buf, 4096, false);
+    buf.out = bs;
+    buf.utf8 = strbuf_new();
+
+    top.y = -sblines(term);
+    top.x = 0;
+    bottom.y = find_last_nonempty_line(term, term->screen);
+    bottom.x = term->cols;
+    clip_extract(term, &buf, top, bottom, false);
+    clip_flush(&buf, true);
+
+    strbuf_free(buf.utf8);
+    sfree(buf.textbuf);
+}
+
 static void paste_from_clip_local(void *vterm)
 {
     Terminal *term = (Terminal *)vterm;
@@ -7064,6 +7468,18 @@ static void sel_spread(Terminal *term)
     }
 }
 
+/*
+ * A long paste is sent a chunk at a time from a toplevel callback,
+ * so that the GUI stays responsive while it goes. Each chunk is at
+ * most PASTE_CHUNK characters, and ends after a CR if there is one.
+ * If the backend already has more than PASTE_BACKLOG bytes waiting to
+ * be sent, we stop and check again every PASTE_THROTTLE_DELAY,
+ * instead of queueing up the whole paste inside the backend.
+ */
+#define PASTE_CHUNK 4096
+#define PASTE_BACKLOG 65536
+#define PASTE_THROTTLE_DELAY (TICKSPERSEC/50)
+
 static void term_paste_callback(void *vterm)
 {
     Terminal *term = (Terminal *)vterm;
@@ -7071,12 +7487,32 @@ static void term_paste_callback(void *vterm)
     if (term->paste_len == 0)
         return;
 
-    while (term->paste_pos < term->paste_len) {
-        size_t n = 0;
-        while (n + term->paste_pos < term->paste_len) {
-            if (term->paste_buffer[term->paste_pos + n++] == '\015')
-                break;
+    term->paste_throttled = false;
+
+    if (term->paste_pos < term->paste_len) {
+        size_t n = term->paste_len - term->paste_pos;
+
+        if (term->backend &&
+            backend_sendbuffer(term->backend) > PASTE_BACKLOG) {
+            term->paste_throttled = true;
+            term->next_paste = schedule_timer(
+                PASTE_THROTTLE_DELAY, term_timer, term);
+            return;
+        }
+
+        if (n > PASTE_CHUNK) {
+            const wchar_t *chunk = term->paste_buffer + term->paste_pos;
+            n = PASTE_CHUNK;
+            while (n > 0 && chunk[n-1] != '\015')
+                n--;
+            if (n == 0) {
+                n = PASTE_CHUNK;
+                /* Don't split a surrogate pair between chunks */
+                if (IS_HIGH_SURROGATE(chunk[n-1]))
+                    n--;
+            }
         }
+
         if (term->ldisc) {
             strbuf *buf = term_input_data_from_unicode(
                 term, term->paste_buffer + term->paste_pos, n);
@@ -7124,6 +7560,7 @@ void term_do_paste(Terminal *term, const wchar_t *data, size_t len)
     if (term->paste_buffer)
         sfree(term->paste_buffer);
     term->paste_pos = term->paste_len = 0;
+    term->paste_throttled = false;
     term->paste_buffer = snewn(len + 12, wchar_t);
 
     if (term->bracketed_paste && !term->no_bracketed_paste)
@@ -7833,6 +8270,7 @@ void term_nopaste(Terminal *term)
     term_bracketed_paste_stop(term);
     term->paste_buffer = NULL;
     term->paste_len = 0;
+    term->paste_throttled = false;
 }
 
 static void deselect(Terminal *term)
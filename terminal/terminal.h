@@ -22,6 +22,7 @@ typedef struct {
 
 typedef struct termchar termchar;
 typedef struct termline termline;
+typedef struct termscreen termscreen;
 
 struct termchar {
     /*
@@ -58,6 +59,21 @@ struct termline {
     bool trusted;
 };
 
+/*
+ * The lines of a screen (as opposed to the scrollback), kept in a
+ * circular buffer so that any line can be found in constant time, and
+ * scrolling the whole screen by one line (removing the top line and
+ * adding one at the bottom) doesn't move any of the others. Inserting
+ * or removing lines elsewhere shifts whichever side of the buffer is
+ * shorter.
+ */
+struct termscreen {
+    termline **lines;
+    int size;                          /* allocated length; a power of 2 */
+    int start;                         /* index in lines[] of line 0 */
+    int nlines;                        /* number of lines present */
+};
+
 struct bidi_cache_entry {
     int width;
     bool trusted;
@@ -78,12 +94,13 @@ struct terminal_tag {
     int compatibility_level;
 
     tree234 *scrollback;               /* lines scrolled off top of screen */
-    tree234 *screen;                   /* lines on primary screen */
-    tree234 *alt_screen;               /* lines on alternate screen */
+    termscreen *screen;                /* lines on primary screen */
+    termscreen *alt_screen;            /* lines on alternate screen */
     int disptop;                       /* distance scrolled back (0 or -ve) */
     int tempsblines;                   /* number of lines of .scrollback that
                                           can be retrieved onto the terminal
                                           ("temporary scrollback") */
+    struct sbcache_entry *sbcache;     /* recently decompressed .scrollback */
 
     termline **disptext;               /* buffer of text on real screen */
     int dispcursx, dispcursy;          /* location of cursor on real screen */
@@ -226,8 +243,13 @@ struct terminal_tag {
     /* Mask of attributes to pay attention to when painting. */
     int attr_mask;
 
+    /* Number of calls to win_draw_text made by the last do_paint. */
+    unsigned paint_draw_calls;
+
     wchar_t *paste_buffer;
     size_t paste_len, paste_pos;
+    bool paste_throttled;              /* waiting for backend to drain */
+    long next_paste;
 
     Backend *backend;
 
@@ -334,6 +356,7 @@ struct terminal_tag {
     bool no_remote_wintitle;
     bool no_remote_clearscroll;
     bool rawcnp;
+    bool rtf_paste;
     bool utf8linedraw;
     bool rect_select;
     int remote_qtitle_action;
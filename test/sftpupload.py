@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+# Test that a large upload through the SFTP server completes.
+#
+# Runs psftp against Uppity on stdio, and uploads a file many times
+# larger than the initial channel window, several times over. If the
+# server stops reopening the window as it works through its input, the
+# transfer stalls and this test times out. Whether that happens
+# depends on how the server's processing interleaves with the incoming
+# data, hence the repetition.
+
+import argparse
+import filecmp
+import os
+import subprocess
+import sys
+import tempfile
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Test a large psftp upload into Uppity.')
+    parser.add_argument("--builddir", default=".",
+                        help="Directory containing psftp, uppity and "
+                        "puttygen.")
+    parser.add_argument("--size", type=int, default=64 << 20,
+                        help="Size of the file to upload, in bytes.")
+    parser.add_argument("--count", type=int, default=4,
+                        help="Number of times to upload it.")
+    parser.add_argument("--timeout", type=int, default=60,
+                        help="Seconds to wait for the uploads.")
+    args = parser.parse_args()
+
+    def prog(name):
+        return os.path.join(os.path.abspath(args.builddir), name)
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        hostkey = os.path.join(tmpdir, "hostkey")
+        src = os.path.join(tmpdir, "src")
+        dst = os.path.join(tmpdir, "dst")
+        batch = os.path.join(tmpdir, "batch")
+
+        subprocess.check_call([prog("puttygen"), "-q", "-t", "ed25519",
+                               "-o", hostkey, "--new-passphrase",
+                               os.devnull])
+        fingerprint = subprocess.check_output(
+            [prog("puttygen"), "-l", "-E", "sha256", hostkey],
+            text=True).split()[2]
+
+        with open(src, "wb") as fh:
+            fh.write(os.urandom(args.size))
+        with open(batch, "w") as fh:
+            for _ in range(args.count):
+                fh.write("put {} {}\n".format(src, dst))
+
+        proxycmd = "{} --hostkey {} --allow-none-auth".format(
+            prog("uppity"), hostkey)
+        try:
+            subprocess.run(
+                [prog("psftp"), "-batch", "-hostkey", fingerprint,
+                 "-l", "user", "-proxycmd", proxycmd, "-b", batch, "dummy"],
+                stdout=subprocess.DEVNULL, timeout=args.timeout, check=True)
+        except subprocess.TimeoutExpired:
+            sys.exit("uploads did not complete within {:d} seconds "
+                     "({:d} of {:d} bytes in the last file)".format(
+                         args.timeout, os.path.getsize(dst)
+                         if os.path.exists(dst) else 0, args.size))
+
+        if not filecmp.cmp(src, dst, shallow=False):
+            sys.exit("uploaded file differs from the original")
+
+    print("{:d} uploads of {:d} bytes passed".format(args.count, args.size))
+
+if __name__ == '__main__':
+    main()
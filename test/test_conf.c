@@ -715,6 +715,7 @@ void test_simple(void)
     test_bool_simple(CONF_try_tis_auth, "AuthTIS", false);
     test_bool_simple(CONF_try_ki_auth, "AuthKI", true);
     test_bool_simple(CONF_ssh_no_shell, "SshNoShell", false);
+    test_str_simple(CONF_ssh_max_window, "SshMaxWindow", "1G");
     test_str_simple(CONF_termtype, "TerminalType", "xterm");
     test_str_simple(CONF_termspeed, "TerminalSpeed", "38400,38400");
     test_str_ambi_simple(CONF_username, "UserName", "", false);
@@ -1044,9 +1045,54 @@ void test_conf_key_info(void)
     }
 }
 
+void test_scalar_lookup(void)
+{
+    /*
+     * Scalar keys are looked up through a direct index alongside the
+     * tree. Check it follows the tree through every way an entry can
+     * be replaced or removed.
+     */
+    Conf *conf = conf_new(), *copy = conf_new();
+
+    do_defaults(NULL, copy);
+    conf_set_int(conf, CONF_port, 1);
+    conf_set_int(conf, CONF_port, 2);
+    conf_set_str(conf, CONF_host, "foo");
+    if (conf_get_int(conf, CONF_port) != 2 ||
+        strcmp(conf_get_str(conf, CONF_host), "foo")) {
+        printf("fail test_scalar_lookup: replaced values\n");
+        nfails++;
+    }
+
+    conf_copy_into(copy, conf);
+    conf_set_int(conf, CONF_port, 3);
+    if (conf_get_int(copy, CONF_port) != 2 ||
+        strcmp(conf_get_str(copy, CONF_host), "foo")) {
+        printf("fail test_scalar_lookup: copied values\n");
+        nfails++;
+    }
+
+    strbuf *sb = strbuf_new();
+    conf_serialise(BinarySink_UPCAST(sb), conf);
+    conf_clear(copy);
+    BinarySource src[1];
+    BinarySource_BARE_INIT_PL(src, ptrlen_from_strbuf(sb));
+    if (!conf_deserialise(copy, src) ||
+        conf_get_int(copy, CONF_port) != 3 ||
+        strcmp(conf_get_str(copy, CONF_host), "foo")) {
+        printf("fail test_scalar_lookup: deserialised values\n");
+        nfails++;
+    }
+    strbuf_free(sb);
+
+    conf_free(conf);
+    conf_free(copy);
+}
+
 int main(void)
 {
     test_conf_key_info();
     test_simple();
+    test_scalar_lookup();
     return nfails != 0;
 }
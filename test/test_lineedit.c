@@ -25,6 +25,66 @@ FontSpec *platform_default_fontspec(const char *name)
 Filename *platform_default_filename(const char *name)
 { return filename_from_str(""); }
 
+/*
+ * Our own version of the timing API, so that a test can see the
+ * terminal scheduling a timer and then make it go off, by advancing
+ * the clock with mock_advance_time().
+ */
+struct MockTimer {
+    timer_fn_t fn;
+    void *ctx;
+    unsigned long when;
+};
+static struct MockTimer *mock_timers;
+static size_t nmock_timers, mock_timersize;
+static unsigned long mock_now;
+
+unsigned long schedule_timer(int ticks, timer_fn_t fn, void *ctx)
+{
+    sgrowarray(mock_timers, mock_timersize, nmock_timers);
+    mock_timers[nmock_timers].fn = fn;
+    mock_timers[nmock_timers].ctx = ctx;
+    mock_timers[nmock_timers].when = mock_now + ticks;
+    return mock_timers[nmock_timers++].when;
+}
+
+void expire_timer_context(void *ctx)
+{
+    size_t i, j;
+    for (i = j = 0; i < nmock_timers; i++)
+        if (mock_timers[i].ctx != ctx)
+            mock_timers[j++] = mock_timers[i];
+    nmock_timers = j;
+}
+
+unsigned long timing_last_clock(void)
+{
+    return mock_now;
+}
+
+static void mock_advance_time(unsigned long ticks)
+{
+    unsigned long end = mock_now + ticks;
+
+    while (true) {
+        size_t i, next = nmock_timers;
+        for (i = 0; i < nmock_timers; i++)
+            if (mock_timers[i].when <= end &&
+                (next == nmock_timers ||
+                 mock_timers[i].when < mock_timers[next].when))
+                next = i;
+        if (next == nmock_timers)
+            break;
+
+        struct MockTimer t = mock_timers[next];
+        mock_timers[next] = mock_timers[--nmock_timers];
+        mock_now = t.when;
+        t.fn(t.ctx, t.when);
+    }
+
+    mock_now = end;
+}
+
 struct SpecialRecord {
     SessionSpecialCode code;
     int arg;
@@ -38,6 +98,8 @@ typedef struct Mock {
 
     bool echo, edit;
     strbuf *to_terminal, *to_backend;
+    size_t nsends, sendbuffer;
+    bool sendbuffer_grows;             /* sends add to sendbuffer */
 
     struct SpecialRecord *specials;
     size_t nspecials, specialsize;
@@ -63,8 +125,19 @@ static void mock_send(Backend *be, const char *buf, size_t len)
 {
     Mock *mk = container_of(be, Mock, backend);
     put_data(mk->to_backend, buf, len);
+    mk->nsends++;
+    if (mk->sendbuffer_grows)
+        mk->sendbuffer += len;
 }
 
+static size_t mock_sendbuffer(Backend *be)
+{
+    Mock *mk = container_of(be, Mock, backend);
+    return mk->sendbuffer;
+}
+
+static void mock_size(Backend *be, int width, int height) {}
+
 static void mock_special(Backend *be, SessionSpecialCode code, int arg)
 {
     Mock *mk = container_of(be, Mock, backend);
@@ -101,11 +174,18 @@ static bool mock_sendok(Backend *be)
     return true;
 }
 
+static bool mock_setup_draw_ctx(TermWin *win) { return false; }
 static void mock_set_raw_mouse_mode(TermWin *win, bool enable) {}
+static void mock_set_raw_mouse_mode_pointer(TermWin *win, bool enable) {}
+static void mock_palette_set(TermWin *win, unsigned start, unsigned ncolours,
+                             const rgb *colours) {}
 static void mock_palette_get_overrides(TermWin *tw, Terminal *term) {}
 
 static const TermWinVtable mock_termwin_vt = {
+    .setup_draw_ctx = mock_setup_draw_ctx,
     .set_raw_mouse_mode = mock_set_raw_mouse_mode,
+    .set_raw_mouse_mode_pointer = mock_set_raw_mouse_mode_pointer,
+    .palette_set = mock_palette_set,
     .palette_get_overrides = mock_palette_get_overrides,
 };
 
@@ -117,6 +197,8 @@ static const SeatVtable mock_seat_vt = {
 static const BackendVtable mock_backend_vt = {
     .sendok = mock_sendok,
     .send = mock_send,
+    .sendbuffer = mock_sendbuffer,
+    .size = mock_size,
     .special = mock_special,
     .ldisc_option_state = mock_ldisc_option_state,
     .provide_ldisc = mock_provide_ldisc,
@@ -154,6 +236,7 @@ static void mock_free(Mock *mk)
     term_free(mk->term);
     sfree(mk->specials);
     sfree(mk);
+    sfree(mock_timers);
 }
 
 static void reset(Mock *mk)
@@ -162,6 +245,7 @@ static void reset(Mock *mk)
     strbuf_clear(mk->to_terminal);
     strbuf_clear(mk->to_backend);
     mk->nspecials = 0;
+    mk->nsends = 0;
 }
 
 static void test_context(Mock *mk, const char *fmt, ...)
@@ -804,6 +888,97 @@ static void test_edit(Mock *mk, bool echo)
 
 }
 
+static void test_paste(Mock *mk)
+{
+    static const wchar_t nl[] = SEL_NL;
+    wchar_t *paste = NULL;
+    size_t len = 0, size = 0;
+    strbuf *expected = strbuf_new();
+
+    mk->edit = false;
+    mk->echo = false;
+    ldisc_echoedit_update(mk->ldisc);
+    reset(mk);
+
+    /* A paste long enough to need many chunks, and to fill the
+     * backend's buffer several times over if it never drains, with the
+     * clipboard's newlines turned into CRs on the way */
+    for (int i = 0; i < 10000; i++) {
+        char buf[32];
+        int n = sprintf(buf, "pasted line %d", i);
+        sgrowarrayn(paste, size, len, n + lenof(nl));
+        for (int j = 0; j < n; j++)
+            paste[len++] = buf[j];
+        for (size_t j = 0; j < lenof(nl); j++)
+            paste[len++] = nl[j];
+        put_data(expected, buf, n);
+        put_byte(expected, '\015');
+    }
+
+    term_do_paste(mk->term, paste, len);
+    while (toplevel_callback_pending())
+        run_toplevel_callbacks();
+    EXPECT(mk, backend, ptrlen_from_strbuf(expected));
+    if (mk->nsends > len / 1000) {
+        print_context(mk, __FILE__, __LINE__);
+        printf("paste of %zu chars took %zu sends\n", len, mk->nsends);
+        mk->any_test_failed = true;
+    }
+    reset(mk);
+
+    /* If the backend builds up a backlog partway through, the paste
+     * stops until the throttle timer finds that it has drained, and
+     * then carries on where it left off */
+    mk->sendbuffer_grows = true;
+    term_do_paste(mk->term, paste, len);
+    size_t stalls = 0;
+    while (true) {
+        while (toplevel_callback_pending())
+            run_toplevel_callbacks();
+        if (mk->to_backend->len >= expected->len || stalls > len)
+            break;
+        stalls++;
+
+        size_t sent = mk->to_backend->len;
+        mock_advance_time(TICKSPERSEC);
+        while (toplevel_callback_pending())
+            run_toplevel_callbacks();
+        if (mk->to_backend->len != sent) {
+            print_context(mk, __FILE__, __LINE__);
+            printf("paste continued while backend had %zu bytes "
+                   "buffered\n", mk->sendbuffer);
+            mk->any_test_failed = true;
+            break;
+        }
+
+        mk->sendbuffer = 0;
+        mock_advance_time(TICKSPERSEC);
+    }
+    EXPECT(mk, backend, ptrlen_from_strbuf(expected));
+    if (stalls == 0) {
+        print_context(mk, __FILE__, __LINE__);
+        printf("paste of %zu chars was never throttled\n", len);
+        mk->any_test_failed = true;
+    }
+    mk->sendbuffer_grows = false;
+    mk->sendbuffer = 0;
+    reset(mk);
+
+    /* If the backend is already sitting on a lot of unsent data, the
+     * paste waits for it to drain */
+    mk->sendbuffer = 1000000;
+    term_do_paste(mk->term, paste, len);
+    while (toplevel_callback_pending())
+        run_toplevel_callbacks();
+    EXPECT(mk, backend, PTRLEN_LITERAL(""));
+    term_nopaste(mk->term);
+    mk->sendbuffer = 0;
+    reset(mk);
+
+    sfree(paste);
+    strbuf_free(expected);
+}
+
 const struct BackendVtable *const backends[] = { &mock_backend_vt, NULL };
 
 int main(void)
@@ -812,10 +987,12 @@ int main(void)
     mk->term = term_init(mk->conf, mk->ucsdata, &mk->tw);
     Ldisc *ldisc = ldisc_create(mk->conf, mk->term, &mk->backend, &mk->seat);
     term_size(mk->term, 80, 24, 0);
+    term_provide_backend(mk->term, &mk->backend);
 
     test_noedit(mk);
     test_edit(mk, true);
     test_edit(mk, false);
+    test_paste(mk);
 
     ldisc_free(ldisc);
 
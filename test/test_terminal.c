@@ -34,17 +34,38 @@ typedef struct Mock {
 
     strbuf *context;
 
+    /* If true, let the terminal paint, and log its calls to draw_text */
+    bool painting;
+    unsigned draw_calls;
+    strbuf *drawn;
+
     bool any_test_failed;
 
     TermWin tw;
 } Mock;
 
-static bool mock_setup_draw_ctx(TermWin *win) { return false; }
+static bool mock_setup_draw_ctx(TermWin *win)
+{
+    Mock *mk = container_of(win, Mock, tw);
+    return mk->painting;
+}
 static void mock_draw_text(TermWin *win, int x, int y, wchar_t *text, int len,
-                           unsigned long attrs, int lattrs, truecolour tc) {}
+                           unsigned long attrs, int lattrs, truecolour tc)
+{
+    Mock *mk = container_of(win, Mock, tw);
+    mk->draw_calls++;
+    put_fmt(mk->drawn, "%d,%d:", x, y);
+    for (int i = 0; i < len; i++)
+        put_byte(mk->drawn, text[i] < 0x80 ? text[i] : '?');
+    put_byte(mk->drawn, ';');
+}
 static void mock_draw_cursor(TermWin *win, int x, int y, wchar_t *text,
                              int len, unsigned long attrs, int lattrs,
                              truecolour tc) {}
+static int mock_char_width(TermWin *win, int uc) { return 1; }
+static void mock_free_draw_ctx(TermWin *win) {}
+static void mock_set_cursor_pos(TermWin *win, int x, int y) {}
+static void mock_set_scrollbar(TermWin *win, int total, int start, int page) {}
 static void mock_set_raw_mouse_mode(TermWin *win, bool enable) {}
 static void mock_set_raw_mouse_mode_pointer(TermWin *win, bool enable) {}
 static void mock_palette_set(TermWin *win, unsigned start, unsigned ncolours,
@@ -55,6 +76,10 @@ static const TermWinVtable mock_termwin_vt = {
     .setup_draw_ctx = mock_setup_draw_ctx,
     .draw_text = mock_draw_text,
     .draw_cursor = mock_draw_cursor,
+    .char_width = mock_char_width,
+    .free_draw_ctx = mock_free_draw_ctx,
+    .set_cursor_pos = mock_set_cursor_pos,
+    .set_scrollbar = mock_set_scrollbar,
     .set_raw_mouse_mode = mock_set_raw_mouse_mode,
     .set_raw_mouse_mode_pointer = mock_set_raw_mouse_mode_pointer,
     .palette_set = mock_palette_set,
@@ -73,6 +98,7 @@ static Mock *mock_new(void)
     mk->ucsdata->line_codepage = CP_ISO8859_1;
 
     mk->context = strbuf_new();
+    mk->drawn = strbuf_new();
 
     mk->tw.vt = &mock_termwin_vt;
 
@@ -82,6 +108,7 @@ static Mock *mock_new(void)
 static void mock_free(Mock *mk)
 {
     strbuf_free(mk->context);
+    strbuf_free(mk->drawn);
     conf_free(mk->conf);
     term_free(mk->term);
     sfree(mk);
@@ -482,6 +509,239 @@ static void test_nonwrap(Mock *mk)
     IEQUAL(get_termchar(mk->term, 79, 0).chr, 0xFFFD);
 }
 
+static void check_rows(Mock *mk, const char *file, int line,
+                       const unsigned long *expect)
+{
+    for (int y = 0; y < 24; y++) {
+        unsigned long chr = get_termchar(mk->term, 0, y).chr;
+        if (chr != expect[y])
+            report_fail(mk, file, line, "row %d: %#lx != %#lx",
+                        y, chr, expect[y]);
+    }
+}
+
+#define ROWS(expect) check_rows(mk, __FILE__, __LINE__, expect)
+
+static void test_scroll(Mock *mk)
+{
+    /* Test that scrolling the whole screen, and scroll regions within
+     * it, moves the right lines to the right places */
+    unsigned long expect[24], blank = CSET_ASCII | ' ';
+    mk->ucsdata->line_codepage = CP_ISO8859_1;
+
+    reset(mk);
+    term_size(mk->term, 24, 80, 100);
+    for (int i = 0; i < 30; i++) {
+        char c = 'A' + i;
+        term_data(mk->term, &c, 1);
+        if (i < 29)
+            term_datapl(mk->term, PTRLEN_LITERAL("\r\n"));
+    }
+    for (int y = 0; y < 24; y++)
+        expect[y] = CSET_ASCII | ('G' + y);
+    ROWS(expect);
+
+    /* Insert two lines at the top of a region covering rows 4-9 */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[5;10r\033[5;1H\033[2L"));
+    memmove(expect + 6, expect + 4, 4 * sizeof(*expect));
+    expect[4] = expect[5] = blank;
+    ROWS(expect);
+
+    /* Delete three lines at the top of the same region */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[3M"));
+    memmove(expect + 4, expect + 7, 3 * sizeof(*expect));
+    expect[7] = expect[8] = expect[9] = blank;
+    ROWS(expect);
+
+    /* Scroll the region backwards with reverse index at its top */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033M"));
+    memmove(expect + 5, expect + 4, 5 * sizeof(*expect));
+    expect[4] = blank;
+    ROWS(expect);
+
+    /* Remove the region, and scroll the whole screen by three lines */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[r\033[24;1H\n\n\n"));
+    memmove(expect, expect + 3, 21 * sizeof(*expect));
+    expect[21] = expect[22] = expect[23] = blank;
+    ROWS(expect);
+
+    /* And backwards by one */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[1;1H\033M"));
+    memmove(expect + 1, expect, 23 * sizeof(*expect));
+    expect[0] = blank;
+    ROWS(expect);
+
+    /* The lines that went off the top should be in the scrollback,
+     * most recent last */
+    IEQUAL(get_termchar(mk->term, 0, -1).chr, CSET_ASCII | 'I');
+    IEQUAL(get_termchar(mk->term, 0, -3).chr, CSET_ASCII | 'G');
+}
+
+static void check_line_text(Mock *mk, const char *file, int line,
+                            int y, const char *expect)
+{
+    for (int x = 0; expect[x]; x++) {
+        unsigned long chr = get_termchar(mk->term, x, y).chr;
+        if (chr != (CSET_ASCII | (unsigned char)expect[x])) {
+            report_fail(mk, file, line, "line %d col %d: %#lx != '%c'",
+                        y, x, chr, expect[x]);
+            return;
+        }
+    }
+}
+
+#define LINE_TEXT(y, expect) check_line_text(mk, __FILE__, __LINE__, y, expect)
+
+static void test_scrollback_resize(Mock *mk)
+{
+    char buf[64];
+    mk->ucsdata->line_codepage = CP_ISO8859_1;
+
+    reset(mk);
+    term_size(mk->term, 4, 30, 5);
+    for (int i = 0; i < 20; i++) {
+        int len = sprintf(buf, "%sline %02d is quite long", i ? "\r\n" : "",
+                          i);
+        term_data(mk->term, buf, len);
+    }
+    for (int i = 0; i < 5; i++) {
+        sprintf(buf, "line %02d is quite long", 15 - i);
+        LINE_TEXT(-1 - i, buf);
+    }
+
+    /* Push some of those lines out of the scrollback, and check that
+     * we don't see stale copies of them in their place */
+    for (int i = 20; i < 23; i++) {
+        int len = sprintf(buf, "\r\nline %02d is quite long", i);
+        term_data(mk->term, buf, len);
+    }
+    for (int i = 0; i < 5; i++) {
+        sprintf(buf, "line %02d is quite long", 18 - i);
+        LINE_TEXT(-1 - i, buf);
+    }
+
+    /* Narrowing the terminal doesn't lose text from the scrollback,
+     * and widening it again pads the lines with blanks */
+    term_size(mk->term, 4, 10, 5);
+    LINE_TEXT(-1, "line 18 is quite long");
+    term_size(mk->term, 4, 40, 5);
+    LINE_TEXT(-1, "line 18 is quite long                  ");
+    IEQUAL(get_termchar(mk->term, 39, -5).chr, CSET_ASCII | ' ');
+    LINE_TEXT(-5, "line 14 is quite long");
+}
+
+static void test_save_scrollback(Mock *mk)
+{
+    static const int clips[] = { CLIP_LOCAL };
+    strbuf *saved = strbuf_new(), *copied = strbuf_new();
+    char buf[64];
+
+    mk->ucsdata->line_codepage = CP_UTF8;
+    reset(mk);
+    term_size(mk->term, 4, 40, 1000);
+
+    /* Enough text to need several chunks, with some multibyte
+     * characters, and with lines that are wrapped, trailing-space
+     * trimmed, and empty */
+    for (int i = 0; i < 300; i++) {
+        int len = sprintf(buf, "line %03d caf\xc3\xa9 \xf0\x9f\x98\x80   "
+                          "\r\n", i);
+        term_data(mk->term, buf, len);
+        if (i % 50 == 0)
+            term_datapl(mk->term, PTRLEN_LITERAL(
+                            "\r\n0123456789012345678901234567890123456789"
+                            "wrapped\r\n"));
+    }
+
+    term_save_scrollback(mk->term, BinarySink_UPCAST(saved));
+
+    term_copyall(mk->term, clips, lenof(clips));
+    for (size_t i = 0; i < mk->term->last_selected_len; i++)
+        if (mk->term->last_selected_text[i])
+            put_utf8_char(copied, mk->term->last_selected_text[i]);
+
+    IEQUAL(saved->len, copied->len);
+    if (saved->len == copied->len)
+        IEQUAL(memcmp(saved->s, copied->s, saved->len), 0);
+    IEQUAL(strncmp(saved->s, "line 000 caf\xc3\xa9 \xf0\x9f\x98\x80", 19), 0);
+    IEQUAL(!strstr(saved->s, "0123456789012345678901234567890123456789"
+                   "wrapped"), 0);
+
+    strbuf_free(saved);
+    strbuf_free(copied);
+}
+
+/*
+ * Repaint the terminal, returning a description of the text runs it
+ * drew.
+ */
+static const char *paint(Mock *mk)
+{
+    mk->painting = true;
+    mk->draw_calls = 0;
+    strbuf_clear(mk->drawn);
+    term_update(mk->term);
+    mk->painting = false;
+    return mk->drawn->s;
+}
+
+#define PAINTED(expect) check_painted(mk, __FILE__, __LINE__, expect)
+
+static void check_painted(Mock *mk, const char *file, int line,
+                          const char *expect)
+{
+    const char *drawn = paint(mk);
+    if (strcmp(drawn, expect))
+        report_fail(mk, file, line, "painted \"%s\", expected \"%s\"",
+                    drawn, expect);
+    check_iequal(mk, file, line, mk->term->paint_draw_calls, mk->draw_calls);
+}
+
+static void test_paint_runs(Mock *mk)
+{
+    mk->ucsdata->line_codepage = CP_ISO8859_1;
+
+    reset(mk);
+    term_size(mk->term, 2, 12, 0);
+    /* Hide the cursor. (Moving it still invalidates the cell it was
+     * in, so the tests below leave it where they found it.) */
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[?25l"));
+    paint(mk);
+
+    /* A space between words of different colours joins one of the
+     * neighbouring runs, and so do the default-coloured spaces at the
+     * end of the line */
+    term_datapl(mk->term, PTRLEN_LITERAL(
+                    "\033[31mab\033[32m \033[33mcd\033[m"));
+    PAINTED("0,0:ab ;3,0:cd       ;");
+
+    /* But not if it's underlined, or has a different background */
+    term_datapl(mk->term, PTRLEN_LITERAL(
+                    "\033[2;1H\033[31mab\033[4m \033[24;41m \033[33;49mcd"
+                    "\033[1;6H"));
+    PAINTED("0,1:ab;2,1: ;3,1: ;4,1:cd      ;");
+
+    /* Redrawing a few unchanged cells is cheaper than a second call */
+    term_datapl(mk->term, PTRLEN_LITERAL(
+                    "\033[m\033[2J\033[1;1H\033[31ma\033[32mb\033[31mc"
+                    "\033[32md\033[31me\033[m"));
+    paint(mk);
+    term_datapl(mk->term, PTRLEN_LITERAL(
+                    "\033[31m\033[1;2Hb\033[1;4Hd\033[1;6H"));
+    PAINTED("1,0:bcd;");
+
+    /* ... but not a lot of them */
+    term_datapl(mk->term, PTRLEN_LITERAL(
+                    "\033[2;1H\033[31ma\033[32mb\033[31mcdefghijk"
+                    "\033[32ml\033[m"));
+    paint(mk);
+    term_datapl(mk->term, PTRLEN_LITERAL("\033[31m\033[2;2Hb\033[2;12Hl"));
+    PAINTED("1,1:b;11,1:l;");
+
+    /* And nothing at all is drawn if nothing changed */
+    PAINTED("");
+}
+
 int main(void)
 {
     Mock *mk = mock_new();
@@ -490,6 +750,10 @@ int main(void)
     test_hello_world(mk);
     test_wrap(mk);
     test_nonwrap(mk);
+    test_scroll(mk);
+    test_scrollback_resize(mk);
+    test_save_scrollback(mk);
+    test_paint_runs(mk);
 
     bool failed = mk->any_test_failed;
     mock_free(mk);
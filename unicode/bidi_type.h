@@ -1,1381 +0,0 @@
-/*
- * Autogenerated by read_ucd.py from The Unicode Standard 16.0.0
- *
- * Bidirectional type of every Unicode character, excluding those with
- * type ON.
- *
- * Used by terminal/bidi.c, whose associated lookup function returns ON
- * by default for anything not in this list.
- */
-
-{0x0000, 0x0008, BN},
-{0x0009, 0x0009, S},
-{0x000a, 0x000a, B},
-{0x000b, 0x000b, S},
-{0x000c, 0x000c, WS},
-{0x000d, 0x000d, B},
-{0x000e, 0x001b, BN},
-{0x001c, 0x001e, B},
-{0x001f, 0x001f, S},
-{0x0020, 0x0020, WS},
-{0x0023, 0x0025, ET},
-{0x002b, 0x002b, ES},
-{0x002c, 0x002c, CS},
-{0x002d, 0x002d, ES},
-{0x002e, 0x002f, CS},
-{0x0030, 0x0039, EN},
-{0x003a, 0x003a, CS},
-{0x0041, 0x005a, L},
-{0x0061, 0x007a, L},
-{0x007f, 0x0084, BN},
-{0x0085, 0x0085, B},
-{0x0086, 0x009f, BN},
-{0x00a0, 0x00a0, CS},
-{0x00a2, 0x00a5, ET},
-{0x00aa, 0x00aa, L},
-{0x00ad, 0x00ad, BN},
-{0x00b0, 0x00b1, ET},
-{0x00b2, 0x00b3, EN},
-{0x00b5, 0x00b5, L},
-{0x00b9, 0x00b9, EN},
-{0x00ba, 0x00ba, L},
-{0x00c0, 0x00d6, L},
-{0x00d8, 0x00f6, L},
-{0x00f8, 0x02b8, L},
-{0x02bb, 0x02c1, L},
-{0x02d0, 0x02d1, L},
-{0x02e0, 0x02e4, L},
-{0x02ee, 0x02ee, L},
-{0x0300, 0x036f, NSM},
-{0x0370, 0x0373, L},
-{0x0376, 0x0377, L},
-{0x037a, 0x037d, L},
-{0x037f, 0x037f, L},
-{0x0386, 0x0386, L},
-{0x0388, 0x038a, L},
-{0x038c, 0x038c, L},
-{0x038e, 0x03a1, L},
-{0x03a3, 0x03f5, L},
-{0x03f7, 0x0482, L},
-{0x0483, 0x0489, NSM},
-{0x048a, 0x052f, L},
-{0x0531, 0x0556, L},
-{0x0559, 0x0589, L},
-{0x058f, 0x058f, ET},
-{0x0591, 0x05bd, NSM},
-{0x05be, 0x05be, R},
-{0x05bf, 0x05bf, NSM},
-{0x05c0, 0x05c0, R},
-{0x05c1, 0x05c2, NSM},
-{0x05c3, 0x05c3, R},
-{0x05c4, 0x05c5, NSM},
-{0x05c6, 0x05c6, R},
-{0x05c7, 0x05c7, NSM},
-{0x05d0, 0x05ea, R},
-{0x05ef, 0x05f4, R},
-{0x0600, 0x0605, AN},
-{0x0608, 0x0608, AL},
-{0x0609, 0x060a, ET},
-{0x060b, 0x060b, AL},
-{0x060c, 0x060c, CS},
-{0x060d, 0x060d, AL},
-{0x0610, 0x061a, NSM},
-{0x061b, 0x064a, AL},
-{0x064b, 0x065f, NSM},
-{0x0660, 0x0669, AN},
-{0x066a, 0x066a, ET},
-{0x066b, 0x066c, AN},
-{0x066d, 0x066f, AL},
-{0x0670, 0x0670, NSM},
-{0x0671, 0x06d5, AL},
-{0x06d6, 0x06dc, NSM},
-{0x06dd, 0x06dd, AN},
-{0x06df, 0x06e4, NSM},
-{0x06e5, 0x06e6, AL},
-{0x06e7, 0x06e8, NSM},
-{0x06ea, 0x06ed, NSM},
-{0x06ee, 0x06ef, AL},
-{0x06f0, 0x06f9, EN},
-{0x06fa, 0x070d, AL},
-{0x070f, 0x0710, AL},
-{0x0711, 0x0711, NSM},
-{0x0712, 0x072f, AL},
-{0x0730, 0x074a, NSM},
-{0x074d, 0x07a5, AL},
-{0x07a6, 0x07b0, NSM},
-{0x07b1, 0x07b1, AL},
-{0x07c0, 0x07ea, R},
-{0x07eb, 0x07f3, NSM},
-{0x07f4, 0x07f5, R},
-{0x07fa, 0x07fa, R},
-{0x07fd, 0x07fd, NSM},
-{0x07fe, 0x0815, R},
-{0x0816, 0x0819, NSM},
-{0x081a, 0x081a, R},
-{0x081b, 0x0823, NSM},
-{0x0824, 0x0824, R},
-{0x0825, 0x0827, NSM},
-{0x0828, 0x0828, R},
-{0x0829, 0x082d, NSM},
-{0x0830, 0x083e, R},
-{0x0840, 0x0858, R},
-{0x0859, 0x085b, NSM},
-{0x085e, 0x085e, R},
-{0x0860, 0x086a, AL},
-{0x0870, 0x088e, AL},
-{0x0890, 0x0891, AN},
-{0x0897, 0x089f, NSM},
-{0x08a0, 0x08c9, AL},
-{0x08ca, 0x08e1, NSM},
-{0x08e2, 0x08e2, AN},
-{0x08e3, 0x0902, NSM},
-{0x0903, 0x0939, L},
-{0x093a, 0x093a, NSM},
-{0x093b, 0x093b, L},
-{0x093c, 0x093c, NSM},
-{0x093d, 0x0940, L},
-{0x0941, 0x0948, NSM},
-{0x0949, 0x094c, L},
-{0x094d, 0x094d, NSM},
-{0x094e, 0x0950, L},
-{0x0951, 0x0957, NSM},
-{0x0958, 0x0961, L},
-{0x0962, 0x0963, NSM},
-{0x0964, 0x0980, L},
-{0x0981, 0x0981, NSM},
-{0x0982, 0x0983, L},
-{0x0985, 0x098c, L},
-{0x098f, 0x0990, L},
-{0x0993, 0x09a8, L},
-{0x09aa, 0x09b0, L},
-{0x09b2, 0x09b2, L},
-{0x09b6, 0x09b9, L},
-{0x09bc, 0x09bc, NSM},
-{0x09bd, 0x09c0, L},
-{0x09c1, 0x09c4, NSM},
-{0x09c7, 0x09c8, L},
-{0x09cb, 0x09cc, L},
-{0x09cd, 0x09cd, NSM},
-{0x09ce, 0x09ce, L},
-{0x09d7, 0x09d7, L},
-{0x09dc, 0x09dd, L},
-{0x09df, 0x09e1, L},
-{0x09e2, 0x09e3, NSM},
-{0x09e6, 0x09f1, L},
-{0x09f2, 0x09f3, ET},
-{0x09f4, 0x09fa, L},
-{0x09fb, 0x09fb, ET},
-{0x09fc, 0x09fd, L},
-{0x09fe, 0x09fe, NSM},
-{0x0a01, 0x0a02, NSM},
-{0x0a03, 0x0a03, L},
-{0x0a05, 0x0a0a, L},
-{0x0a0f, 0x0a10, L},
-{0x0a13, 0x0a28, L},
-{0x0a2a, 0x0a30, L},
-{0x0a32, 0x0a33, L},
-{0x0a35, 0x0a36, L},
-{0x0a38, 0x0a39, L},
-{0x0a3c, 0x0a3c, NSM},
-{0x0a3e, 0x0a40, L},
-{0x0a41, 0x0a42, NSM},
-{0x0a47, 0x0a48, NSM},
-{0x0a4b, 0x0a4d, NSM},
-{0x0a51, 0x0a51, NSM},
-{0x0a59, 0x0a5c, L},
-{0x0a5e, 0x0a5e, L},
-{0x0a66, 0x0a6f, L},
-{0x0a70, 0x0a71, NSM},
-{0x0a72, 0x0a74, L},
-{0x0a75, 0x0a75, NSM},
-{0x0a76, 0x0a76, L},
-{0x0a81, 0x0a82, NSM},
-{0x0a83, 0x0a83, L},
-{0x0a85, 0x0a8d, L},
-{0x0a8f, 0x0a91, L},
-{0x0a93, 0x0aa8, L},
-{0x0aaa, 0x0ab0, L},
-{0x0ab2, 0x0ab3, L},
-{0x0ab5, 0x0ab9, L},
-{0x0abc, 0x0abc, NSM},
-{0x0abd, 0x0ac0, L},
-{0x0ac1, 0x0ac5, NSM},
-{0x0ac7, 0x0ac8, NSM},
-{0x0ac9, 0x0ac9, L},
-{0x0acb, 0x0acc, L},
-{0x0acd, 0x0acd, NSM},
-{0x0ad0, 0x0ad0, L},
-{0x0ae0, 0x0ae1, L},
-{0x0ae2, 0x0ae3, NSM},
-{0x0ae6, 0x0af0, L},
-{0x0af1, 0x0af1, ET},
-{0x0af9, 0x0af9, L},
-{0x0afa, 0x0aff, NSM},
-{0x0b01, 0x0b01, NSM},
-{0x0b02, 0x0b03, L},
-{0x0b05, 0x0b0c, L},
-{0x0b0f, 0x0b10, L},
-{0x0b13, 0x0b28, L},
-{0x0b2a, 0x0b30, L},
-{0x0b32, 0x0b33, L},
-{0x0b35, 0x0b39, L},
-{0x0b3c, 0x0b3c, NSM},
-{0x0b3d, 0x0b3e, L},
-{0x0b3f, 0x0b3f, NSM},
-{0x0b40, 0x0b40, L},
-{0x0b41, 0x0b44, NSM},
-{0x0b47, 0x0b48, L},
-{0x0b4b, 0x0b4c, L},
-{0x0b4d, 0x0b4d, NSM},
-{0x0b55, 0x0b56, NSM},
-{0x0b57, 0x0b57, L},
-{0x0b5c, 0x0b5d, L},
-{0x0b5f, 0x0b61, L},
-{0x0b62, 0x0b63, NSM},
-{0x0b66, 0x0b77, L},
-{0x0b82, 0x0b82, NSM},
-{0x0b83, 0x0b83, L},
-{0x0b85, 0x0b8a, L},
-{0x0b8e, 0x0b90, L},
-{0x0b92, 0x0b95, L},
-{0x0b99, 0x0b9a, L},
-{0x0b9c, 0x0b9c, L},
-{0x0b9e, 0x0b9f, L},
-{0x0ba3, 0x0ba4, L},
-{0x0ba8, 0x0baa, L},
-{0x0bae, 0x0bb9, L},
-{0x0bbe, 0x0bbf, L},
-{0x0bc0, 0x0bc0, NSM},
-{0x0bc1, 0x0bc2, L},
-{0x0bc6, 0x0bc8, L},
-{0x0bca, 0x0bcc, L},
-{0x0bcd, 0x0bcd, NSM},
-{0x0bd0, 0x0bd0, L},
-{0x0bd7, 0x0bd7, L},
-{0x0be6, 0x0bf2, L},
-{0x0bf9, 0x0bf9, ET},
-{0x0c00, 0x0c00, NSM},
-{0x0c01, 0x0c03, L},
-{0x0c04, 0x0c04, NSM},
-{0x0c05, 0x0c0c, L},
-{0x0c0e, 0x0c10, L},
-{0x0c12, 0x0c28, L},
-{0x0c2a, 0x0c39, L},
-{0x0c3c, 0x0c3c, NSM},
-{0x0c3d, 0x0c3d, L},
-{0x0c3e, 0x0c40, NSM},
-{0x0c41, 0x0c44, L},
-{0x0c46, 0x0c48, NSM},
-{0x0c4a, 0x0c4d, NSM},
-{0x0c55, 0x0c56, NSM},
-{0x0c58, 0x0c5a, L},
-{0x0c5d, 0x0c5d, L},
-{0x0c60, 0x0c61, L},
-{0x0c62, 0x0c63, NSM},
-{0x0c66, 0x0c6f, L},
-{0x0c77, 0x0c77, L},
-{0x0c7f, 0x0c80, L},
-{0x0c81, 0x0c81, NSM},
-{0x0c82, 0x0c8c, L},
-{0x0c8e, 0x0c90, L},
-{0x0c92, 0x0ca8, L},
-{0x0caa, 0x0cb3, L},
-{0x0cb5, 0x0cb9, L},
-{0x0cbc, 0x0cbc, NSM},
-{0x0cbd, 0x0cc4, L},
-{0x0cc6, 0x0cc8, L},
-{0x0cca, 0x0ccb, L},
-{0x0ccc, 0x0ccd, NSM},
-{0x0cd5, 0x0cd6, L},
-{0x0cdd, 0x0cde, L},
-{0x0ce0, 0x0ce1, L},
-{0x0ce2, 0x0ce3, NSM},
-{0x0ce6, 0x0cef, L},
-{0x0cf1, 0x0cf3, L},
-{0x0d00, 0x0d01, NSM},
-{0x0d02, 0x0d0c, L},
-{0x0d0e, 0x0d10, L},
-{0x0d12, 0x0d3a, L},
-{0x0d3b, 0x0d3c, NSM},
-{0x0d3d, 0x0d40, L},
-{0x0d41, 0x0d44, NSM},
-{0x0d46, 0x0d48, L},
-{0x0d4a, 0x0d4c, L},
-{0x0d4d, 0x0d4d, NSM},
-{0x0d4e, 0x0d4f, L},
-{0x0d54, 0x0d61, L},
-{0x0d62, 0x0d63, NSM},
-{0x0d66, 0x0d7f, L},
-{0x0d81, 0x0d81, NSM},
-{0x0d82, 0x0d83, L},
-{0x0d85, 0x0d96, L},
-{0x0d9a, 0x0db1, L},
-{0x0db3, 0x0dbb, L},
-{0x0dbd, 0x0dbd, L},
-{0x0dc0, 0x0dc6, L},
-{0x0dca, 0x0dca, NSM},
-{0x0dcf, 0x0dd1, L},
-{0x0dd2, 0x0dd4, NSM},
-{0x0dd6, 0x0dd6, NSM},
-{0x0dd8, 0x0ddf, L},
-{0x0de6, 0x0def, L},
-{0x0df2, 0x0df4, L},
-{0x0e01, 0x0e30, L},
-{0x0e31, 0x0e31, NSM},
-{0x0e32, 0x0e33, L},
-{0x0e34, 0x0e3a, NSM},
-{0x0e3f, 0x0e3f, ET},
-{0x0e40, 0x0e46, L},
-{0x0e47, 0x0e4e, NSM},
-{0x0e4f, 0x0e5b, L},
-{0x0e81, 0x0e82, L},
-{0x0e84, 0x0e84, L},
-{0x0e86, 0x0e8a, L},
-{0x0e8c, 0x0ea3, L},
-{0x0ea5, 0x0ea5, L},
-{0x0ea7, 0x0eb0, L},
-{0x0eb1, 0x0eb1, NSM},
-{0x0eb2, 0x0eb3, L},
-{0x0eb4, 0x0ebc, NSM},
-{0x0ebd, 0x0ebd, L},
-{0x0ec0, 0x0ec4, L},
-{0x0ec6, 0x0ec6, L},
-{0x0ec8, 0x0ece, NSM},
-{0x0ed0, 0x0ed9, L},
-{0x0edc, 0x0edf, L},
-{0x0f00, 0x0f17, L},
-{0x0f18, 0x0f19, NSM},
-{0x0f1a, 0x0f34, L},
-{0x0f35, 0x0f35, NSM},
-{0x0f36, 0x0f36, L},
-{0x0f37, 0x0f37, NSM},
-{0x0f38, 0x0f38, L},
-{0x0f39, 0x0f39, NSM},
-{0x0f3e, 0x0f47, L},
-{0x0f49, 0x0f6c, L},
-{0x0f71, 0x0f7e, NSM},
-{0x0f7f, 0x0f7f, L},
-{0x0f80, 0x0f84, NSM},
-{0x0f85, 0x0f85, L},
-{0x0f86, 0x0f87, NSM},
-{0x0f88, 0x0f8c, L},
-{0x0f8d, 0x0f97, NSM},
-{0x0f99, 0x0fbc, NSM},
-{0x0fbe, 0x0fc5, L},
-{0x0fc6, 0x0fc6, NSM},
-{0x0fc7, 0x0fcc, L},
-{0x0fce, 0x0fda, L},
-{0x1000, 0x102c, L},
-{0x102d, 0x1030, NSM},
-{0x1031, 0x1031, L},
-{0x1032, 0x1037, NSM},
-{0x1038, 0x1038, L},
-{0x1039, 0x103a, NSM},
-{0x103b, 0x103c, L},
-{0x103d, 0x103e, NSM},
-{0x103f, 0x1057, L},
-{0x1058, 0x1059, NSM},
-{0x105a, 0x105d, L},
-{0x105e, 0x1060, NSM},
-{0x1061, 0x1070, L},
-{0x1071, 0x1074, NSM},
-{0x1075, 0x1081, L},
-{0x1082, 0x1082, NSM},
-{0x1083, 0x1084, L},
-{0x1085, 0x1086, NSM},
-{0x1087, 0x108c, L},
-{0x108d, 0x108d, NSM},
-{0x108e, 0x109c, L},
-{0x109d, 0x109d, NSM},
-{0x109e, 0x10c5, L},
-{0x10c7, 0x10c7, L},
-{0x10cd, 0x10cd, L},
-{0x10d0, 0x1248, L},
-{0x124a, 0x124d, L},
-{0x1250, 0x1256, L},
-{0x1258, 0x1258, L},
-{0x125a, 0x125d, L},
-{0x1260, 0x1288, L},
-{0x128a, 0x128d, L},
-{0x1290, 0x12b0, L},
-{0x12b2, 0x12b5, L},
-{0x12b8, 0x12be, L},
-{0x12c0, 0x12c0, L},
-{0x12c2, 0x12c5, L},
-{0x12c8, 0x12d6, L},
-{0x12d8, 0x1310, L},
-{0x1312, 0x1315, L},
-{0x1318, 0x135a, L},
-{0x135d, 0x135f, NSM},
-{0x1360, 0x137c, L},
-{0x1380, 0x138f, L},
-{0x13a0, 0x13f5, L},
-{0x13f8, 0x13fd, L},
-{0x1401, 0x167f, L},
-{0x1680, 0x1680, WS},
-{0x1681, 0x169a, L},
-{0x16a0, 0x16f8, L},
-{0x1700, 0x1711, L},
-{0x1712, 0x1714, NSM},
-{0x1715, 0x1715, L},
-{0x171f, 0x1731, L},
-{0x1732, 0x1733, NSM},
-{0x1734, 0x1736, L},
-{0x1740, 0x1751, L},
-{0x1752, 0x1753, NSM},
-{0x1760, 0x176c, L},
-{0x176e, 0x1770, L},
-{0x1772, 0x1773, NSM},
-{0x1780, 0x17b3, L},
-{0x17b4, 0x17b5, NSM},
-{0x17b6, 0x17b6, L},
-{0x17b7, 0x17bd, NSM},
-{0x17be, 0x17c5, L},
-{0x17c6, 0x17c6, NSM},
-{0x17c7, 0x17c8, L},
-{0x17c9, 0x17d3, NSM},
-{0x17d4, 0x17da, L},
-{0x17db, 0x17db, ET},
-{0x17dc, 0x17dc, L},
-{0x17dd, 0x17dd, NSM},
-{0x17e0, 0x17e9, L},
-{0x180b, 0x180d, NSM},
-{0x180e, 0x180e, BN},
-{0x180f, 0x180f, NSM},
-{0x1810, 0x1819, L},
-{0x1820, 0x1878, L},
-{0x1880, 0x1884, L},
-{0x1885, 0x1886, NSM},
-{0x1887, 0x18a8, L},
-{0x18a9, 0x18a9, NSM},
-{0x18aa, 0x18aa, L},
-{0x18b0, 0x18f5, L},
-{0x1900, 0x191e, L},
-{0x1920, 0x1922, NSM},
-{0x1923, 0x1926, L},
-{0x1927, 0x1928, NSM},
-{0x1929, 0x192b, L},
-{0x1930, 0x1931, L},
-{0x1932, 0x1932, NSM},
-{0x1933, 0x1938, L},
-{0x1939, 0x193b, NSM},
-{0x1946, 0x196d, L},
-{0x1970, 0x1974, L},
-{0x1980, 0x19ab, L},
-{0x19b0, 0x19c9, L},
-{0x19d0, 0x19da, L},
-{0x1a00, 0x1a16, L},
-{0x1a17, 0x1a18, NSM},
-{0x1a19, 0x1a1a, L},
-{0x1a1b, 0x1a1b, NSM},
-{0x1a1e, 0x1a55, L},
-{0x1a56, 0x1a56, NSM},
-{0x1a57, 0x1a57, L},
-{0x1a58, 0x1a5e, NSM},
-{0x1a60, 0x1a60, NSM},
-{0x1a61, 0x1a61, L},
-{0x1a62, 0x1a62, NSM},
-{0x1a63, 0x1a64, L},
-{0x1a65, 0x1a6c, NSM},
-{0x1a6d, 0x1a72, L},
-{0x1a73, 0x1a7c, NSM},
-{0x1a7f, 0x1a7f, NSM},
-{0x1a80, 0x1a89, L},
-{0x1a90, 0x1a99, L},
-{0x1aa0, 0x1aad, L},
-{0x1ab0, 0x1ace, NSM},
-{0x1b00, 0x1b03, NSM},
-{0x1b04, 0x1b33, L},
-{0x1b34, 0x1b34, NSM},
-{0x1b35, 0x1b35, L},
-{0x1b36, 0x1b3a, NSM},
-{0x1b3b, 0x1b3b, L},
-{0x1b3c, 0x1b3c, NSM},
-{0x1b3d, 0x1b41, L},
-{0x1b42, 0x1b42, NSM},
-{0x1b43, 0x1b4c, L},
-{0x1b4e, 0x1b6a, L},
-{0x1b6b, 0x1b73, NSM},
-{0x1b74, 0x1b7f, L},
-{0x1b80, 0x1b81, NSM},
-{0x1b82, 0x1ba1, L},
-{0x1ba2, 0x1ba5, NSM},
-{0x1ba6, 0x1ba7, L},
-{0x1ba8, 0x1ba9, NSM},
-{0x1baa, 0x1baa, L},
-{0x1bab, 0x1bad, NSM},
-{0x1bae, 0x1be5, L},
-{0x1be6, 0x1be6, NSM},
-{0x1be7, 0x1be7, L},
-{0x1be8, 0x1be9, NSM},
-{0x1bea, 0x1bec, L},
-{0x1bed, 0x1bed, NSM},
-{0x1bee, 0x1bee, L},
-{0x1bef, 0x1bf1, NSM},
-{0x1bf2, 0x1bf3, L},
-{0x1bfc, 0x1c2b, L},
-{0x1c2c, 0x1c33, NSM},
-{0x1c34, 0x1c35, L},
-{0x1c36, 0x1c37, NSM},
-{0x1c3b, 0x1c49, L},
-{0x1c4d, 0x1c8a, L},
-{0x1c90, 0x1cba, L},
-{0x1cbd, 0x1cc7, L},
-{0x1cd0, 0x1cd2, NSM},
-{0x1cd3, 0x1cd3, L},
-{0x1cd4, 0x1ce0, NSM},
-{0x1ce1, 0x1ce1, L},
-{0x1ce2, 0x1ce8, NSM},
-{0x1ce9, 0x1cec, L},
-{0x1ced, 0x1ced, NSM},
-{0x1cee, 0x1cf3, L},
-{0x1cf4, 0x1cf4, NSM},
-{0x1cf5, 0x1cf7, L},
-{0x1cf8, 0x1cf9, NSM},
-{0x1cfa, 0x1cfa, L},
-{0x1d00, 0x1dbf, L},
-{0x1dc0, 0x1dff, NSM},
-{0x1e00, 0x1f15, L},
-{0x1f18, 0x1f1d, L},
-{0x1f20, 0x1f45, L},
-{0x1f48, 0x1f4d, L},
-{0x1f50, 0x1f57, L},
-{0x1f59, 0x1f59, L},
-{0x1f5b, 0x1f5b, L},
-{0x1f5d, 0x1f5d, L},
-{0x1f5f, 0x1f7d, L},
-{0x1f80, 0x1fb4, L},
-{0x1fb6, 0x1fbc, L},
-{0x1fbe, 0x1fbe, L},
-{0x1fc2, 0x1fc4, L},
-{0x1fc6, 0x1fcc, L},
-{0x1fd0, 0x1fd3, L},
-{0x1fd6, 0x1fdb, L},
-{0x1fe0, 0x1fec, L},
-{0x1ff2, 0x1ff4, L},
-{0x1ff6, 0x1ffc, L},
-{0x2000, 0x200a, WS},
-{0x200b, 0x200d, BN},
-{0x200e, 0x200e, L},
-{0x200f, 0x200f, R},
-{0x2028, 0x2028, WS},
-{0x2029, 0x2029, B},
-{0x202a, 0x202a, LRE},
-{0x202b, 0x202b, RLE},
-{0x202c, 0x202c, PDF},
-{0x202d, 0x202d, LRO},
-{0x202e, 0x202e, RLO},
-{0x202f, 0x202f, CS},
-{0x2030, 0x2034, ET},
-{0x2044, 0x2044, CS},
-{0x205f, 0x205f, WS},
-{0x2060, 0x2064, BN},
-{0x2066, 0x2066, LRI},
-{0x2067, 0x2067, RLI},
-{0x2068, 0x2068, FSI},
-{0x2069, 0x2069, PDI},
-{0x206a, 0x206f, BN},
-{0x2070, 0x2070, EN},
-{0x2071, 0x2071, L},
-{0x2074, 0x2079, EN},
-{0x207a, 0x207b, ES},
-{0x207f, 0x207f, L},
-{0x2080, 0x2089, EN},
-{0x208a, 0x208b, ES},
-{0x2090, 0x209c, L},
-{0x20a0, 0x20c0, ET},
-{0x20d0, 0x20f0, NSM},
-{0x2102, 0x2102, L},
-{0x2107, 0x2107, L},
-{0x210a, 0x2113, L},
-{0x2115, 0x2115, L},
-{0x2119, 0x211d, L},
-{0x2124, 0x2124, L},
-{0x2126, 0x2126, L},
-{0x2128, 0x2128, L},
-{0x212a, 0x212d, L},
-{0x212e, 0x212e, ET},
-{0x212f, 0x2139, L},
-{0x213c, 0x213f, L},
-{0x2145, 0x2149, L},
-{0x214e, 0x214f, L},
-{0x2160, 0x2188, L},
-{0x2212, 0x2212, ES},
-{0x2213, 0x2213, ET},
-{0x2336, 0x237a, L},
-{0x2395, 0x2395, L},
-{0x2488, 0x249b, EN},
-{0x249c, 0x24e9, L},
-{0x26ac, 0x26ac, L},
-{0x2800, 0x28ff, L},
-{0x2c00, 0x2ce4, L},
-{0x2ceb, 0x2cee, L},
-{0x2cef, 0x2cf1, NSM},
-{0x2cf2, 0x2cf3, L},
-{0x2d00, 0x2d25, L},
-{0x2d27, 0x2d27, L},
-{0x2d2d, 0x2d2d, L},
-{0x2d30, 0x2d67, L},
-{0x2d6f, 0x2d70, L},
-{0x2d7f, 0x2d7f, NSM},
-{0x2d80, 0x2d96, L},
-{0x2da0, 0x2da6, L},
-{0x2da8, 0x2dae, L},
-{0x2db0, 0x2db6, L},
-{0x2db8, 0x2dbe, L},
-{0x2dc0, 0x2dc6, L},
-{0x2dc8, 0x2dce, L},
-{0x2dd0, 0x2dd6, L},
-{0x2dd8, 0x2dde, L},
-{0x2de0, 0x2dff, NSM},
-{0x3000, 0x3000, WS},
-{0x3005, 0x3007, L},
-{0x3021, 0x3029, L},
-{0x302a, 0x302d, NSM},
-{0x302e, 0x302f, L},
-{0x3031, 0x3035, L},
-{0x3038, 0x303c, L},
-{0x3041, 0x3096, L},
-{0x3099, 0x309a, NSM},
-{0x309d, 0x309f, L},
-{0x30a1, 0x30fa, L},
-{0x30fc, 0x30ff, L},
-{0x3105, 0x312f, L},
-{0x3131, 0x318e, L},
-{0x3190, 0x31bf, L},
-{0x31f0, 0x321c, L},
-{0x3220, 0x324f, L},
-{0x3260, 0x327b, L},
-{0x327f, 0x32b0, L},
-{0x32c0, 0x32cb, L},
-{0x32d0, 0x3376, L},
-{0x337b, 0x33dd, L},
-{0x33e0, 0x33fe, L},
-{0x3400, 0x4dbf, L},
-{0x4e00, 0xa48c, L},
-{0xa4d0, 0xa60c, L},
-{0xa610, 0xa62b, L},
-{0xa640, 0xa66e, L},
-{0xa66f, 0xa672, NSM},
-{0xa674, 0xa67d, NSM},
-{0xa680, 0xa69d, L},
-{0xa69e, 0xa69f, NSM},
-{0xa6a0, 0xa6ef, L},
-{0xa6f0, 0xa6f1, NSM},
-{0xa6f2, 0xa6f7, L},
-{0xa722, 0xa787, L},
-{0xa789, 0xa7cd, L},
-{0xa7d0, 0xa7d1, L},
-{0xa7d3, 0xa7d3, L},
-{0xa7d5, 0xa7dc, L},
-{0xa7f2, 0xa801, L},
-{0xa802, 0xa802, NSM},
-{0xa803, 0xa805, L},
-{0xa806, 0xa806, NSM},
-{0xa807, 0xa80a, L},
-{0xa80b, 0xa80b, NSM},
-{0xa80c, 0xa824, L},
-{0xa825, 0xa826, NSM},
-{0xa827, 0xa827, L},
-{0xa82c, 0xa82c, NSM},
-{0xa830, 0xa837, L},
-{0xa838, 0xa839, ET},
-{0xa840, 0xa873, L},
-{0xa880, 0xa8c3, L},
-{0xa8c4, 0xa8c5, NSM},
-{0xa8ce, 0xa8d9, L},
-{0xa8e0, 0xa8f1, NSM},
-{0xa8f2, 0xa8fe, L},
-{0xa8ff, 0xa8ff, NSM},
-{0xa900, 0xa925, L},
-{0xa926, 0xa92d, NSM},
-{0xa92e, 0xa946, L},
-{0xa947, 0xa951, NSM},
-{0xa952, 0xa953, L},
-{0xa95f, 0xa97c, L},
-{0xa980, 0xa982, NSM},
-{0xa983, 0xa9b2, L},
-{0xa9b3, 0xa9b3, NSM},
-{0xa9b4, 0xa9b5, L},
-{0xa9b6, 0xa9b9, NSM},
-{0xa9ba, 0xa9bb, L},
-{0xa9bc, 0xa9bd, NSM},
-{0xa9be, 0xa9cd, L},
-{0xa9cf, 0xa9d9, L},
-{0xa9de, 0xa9e4, L},
-{0xa9e5, 0xa9e5, NSM},
-{0xa9e6, 0xa9fe, L},
-{0xaa00, 0xaa28, L},
-{0xaa29, 0xaa2e, NSM},
-{0xaa2f, 0xaa30, L},
-{0xaa31, 0xaa32, NSM},
-{0xaa33, 0xaa34, L},
-{0xaa35, 0xaa36, NSM},
-{0xaa40, 0xaa42, L},
-{0xaa43, 0xaa43, NSM},
-{0xaa44, 0xaa4b, L},
-{0xaa4c, 0xaa4c, NSM},
-{0xaa4d, 0xaa4d, L},
-{0xaa50, 0xaa59, L},
-{0xaa5c, 0xaa7b, L},
-{0xaa7c, 0xaa7c, NSM},
-{0xaa7d, 0xaaaf, L},
-{0xaab0, 0xaab0, NSM},
-{0xaab1, 0xaab1, L},
-{0xaab2, 0xaab4, NSM},
-{0xaab5, 0xaab6, L},
-{0xaab7, 0xaab8, NSM},
-{0xaab9, 0xaabd, L},
-{0xaabe, 0xaabf, NSM},
-{0xaac0, 0xaac0, L},
-{0xaac1, 0xaac1, NSM},
-{0xaac2, 0xaac2, L},
-{0xaadb, 0xaaeb, L},
-{0xaaec, 0xaaed, NSM},
-{0xaaee, 0xaaf5, L},
-{0xaaf6, 0xaaf6, NSM},
-{0xab01, 0xab06, L},
-{0xab09, 0xab0e, L},
-{0xab11, 0xab16, L},
-{0xab20, 0xab26, L},
-{0xab28, 0xab2e, L},
-{0xab30, 0xab69, L},
-{0xab70, 0xabe4, L},
-{0xabe5, 0xabe5, NSM},
-{0xabe6, 0xabe7, L},
-{0xabe8, 0xabe8, NSM},
-{0xabe9, 0xabec, L},
-{0xabed, 0xabed, NSM},
-{0xabf0, 0xabf9, L},
-{0xac00, 0xd7a3, L},
-{0xd7b0, 0xd7c6, L},
-{0xd7cb, 0xd7fb, L},
-{0xd800, 0xfa6d, L},
-{0xfa70, 0xfad9, L},
-{0xfb00, 0xfb06, L},
-{0xfb13, 0xfb17, L},
-{0xfb1d, 0xfb1d, R},
-{0xfb1e, 0xfb1e, NSM},
-{0xfb1f, 0xfb28, R},
-{0xfb29, 0xfb29, ES},
-{0xfb2a, 0xfb36, R},
-{0xfb38, 0xfb3c, R},
-{0xfb3e, 0xfb3e, R},
-{0xfb40, 0xfb41, R},
-{0xfb43, 0xfb44, R},
-{0xfb46, 0xfb4f, R},
-{0xfb50, 0xfbc2, AL},
-{0xfbd3, 0xfd3d, AL},
-{0xfd50, 0xfd8f, AL},
-{0xfd92, 0xfdc7, AL},
-{0xfdf0, 0xfdfc, AL},
-{0xfe00, 0xfe0f, NSM},
-{0xfe20, 0xfe2f, NSM},
-{0xfe50, 0xfe50, CS},
-{0xfe52, 0xfe52, CS},
-{0xfe55, 0xfe55, CS},
-{0xfe5f, 0xfe5f, ET},
-{0xfe62, 0xfe63, ES},
-{0xfe69, 0xfe6a, ET},
-{0xfe70, 0xfe74, AL},
-{0xfe76, 0xfefc, AL},
-{0xfeff, 0xfeff, BN},
-{0xff03, 0xff05, ET},
-{0xff0b, 0xff0b, ES},
-{0xff0c, 0xff0c, CS},
-{0xff0d, 0xff0d, ES},
-{0xff0e, 0xff0f, CS},
-{0xff10, 0xff19, EN},
-{0xff1a, 0xff1a, CS},
-{0xff21, 0xff3a, L},
-{0xff41, 0xff5a, L},
-{0xff66, 0xffbe, L},
-{0xffc2, 0xffc7, L},
-{0xffca, 0xffcf, L},
-{0xffd2, 0xffd7, L},
-{0xffda, 0xffdc, L},
-{0xffe0, 0xffe1, ET},
-{0xffe5, 0xffe6, ET},
-{0x10000, 0x1000b, L},
-{0x1000d, 0x10026, L},
-{0x10028, 0x1003a, L},
-{0x1003c, 0x1003d, L},
-{0x1003f, 0x1004d, L},
-{0x10050, 0x1005d, L},
-{0x10080, 0x100fa, L},
-{0x10100, 0x10100, L},
-{0x10102, 0x10102, L},
-{0x10107, 0x10133, L},
-{0x10137, 0x1013f, L},
-{0x1018d, 0x1018e, L},
-{0x101d0, 0x101fc, L},
-{0x101fd, 0x101fd, NSM},
-{0x10280, 0x1029c, L},
-{0x102a0, 0x102d0, L},
-{0x102e0, 0x102e0, NSM},
-{0x102e1, 0x102fb, EN},
-{0x10300, 0x10323, L},
-{0x1032d, 0x1034a, L},
-{0x10350, 0x10375, L},
-{0x10376, 0x1037a, NSM},
-{0x10380, 0x1039d, L},
-{0x1039f, 0x103c3, L},
-{0x103c8, 0x103d5, L},
-{0x10400, 0x1049d, L},
-{0x104a0, 0x104a9, L},
-{0x104b0, 0x104d3, L},
-{0x104d8, 0x104fb, L},
-{0x10500, 0x10527, L},
-{0x10530, 0x10563, L},
-{0x1056f, 0x1057a, L},
-{0x1057c, 0x1058a, L},
-{0x1058c, 0x10592, L},
-{0x10594, 0x10595, L},
-{0x10597, 0x105a1, L},
-{0x105a3, 0x105b1, L},
-{0x105b3, 0x105b9, L},
-{0x105bb, 0x105bc, L},
-{0x105c0, 0x105f3, L},
-{0x10600, 0x10736, L},
-{0x10740, 0x10755, L},
-{0x10760, 0x10767, L},
-{0x10780, 0x10785, L},
-{0x10787, 0x107b0, L},
-{0x107b2, 0x107ba, L},
-{0x10800, 0x10805, R},
-{0x10808, 0x10808, R},
-{0x1080a, 0x10835, R},
-{0x10837, 0x10838, R},
-{0x1083c, 0x1083c, R},
-{0x1083f, 0x10855, R},
-{0x10857, 0x1089e, R},
-{0x108a7, 0x108af, R},
-{0x108e0, 0x108f2, R},
-{0x108f4, 0x108f5, R},
-{0x108fb, 0x1091b, R},
-{0x10920, 0x10939, R},
-{0x1093f, 0x1093f, R},
-{0x10980, 0x109b7, R},
-{0x109bc, 0x109cf, R},
-{0x109d2, 0x10a00, R},
-{0x10a01, 0x10a03, NSM},
-{0x10a05, 0x10a06, NSM},
-{0x10a0c, 0x10a0f, NSM},
-{0x10a10, 0x10a13, R},
-{0x10a15, 0x10a17, R},
-{0x10a19, 0x10a35, R},
-{0x10a38, 0x10a3a, NSM},
-{0x10a3f, 0x10a3f, NSM},
-{0x10a40, 0x10a48, R},
-{0x10a50, 0x10a58, R},
-{0x10a60, 0x10a9f, R},
-{0x10ac0, 0x10ae4, R},
-{0x10ae5, 0x10ae6, NSM},
-{0x10aeb, 0x10af6, R},
-{0x10b00, 0x10b35, R},
-{0x10b40, 0x10b55, R},
-{0x10b58, 0x10b72, R},
-{0x10b78, 0x10b91, R},
-{0x10b99, 0x10b9c, R},
-{0x10ba9, 0x10baf, R},
-{0x10c00, 0x10c48, R},
-{0x10c80, 0x10cb2, R},
-{0x10cc0, 0x10cf2, R},
-{0x10cfa, 0x10cff, R},
-{0x10d00, 0x10d23, AL},
-{0x10d24, 0x10d27, NSM},
-{0x10d30, 0x10d39, AN},
-{0x10d40, 0x10d49, AN},
-{0x10d4a, 0x10d65, R},
-{0x10d69, 0x10d6d, NSM},
-{0x10d6f, 0x10d85, R},
-{0x10d8e, 0x10d8f, R},
-{0x10e60, 0x10e7e, AN},
-{0x10e80, 0x10ea9, R},
-{0x10eab, 0x10eac, NSM},
-{0x10ead, 0x10ead, R},
-{0x10eb0, 0x10eb1, R},
-{0x10ec2, 0x10ec4, AL},
-{0x10efc, 0x10eff, NSM},
-{0x10f00, 0x10f27, R},
-{0x10f30, 0x10f45, AL},
-{0x10f46, 0x10f50, NSM},
-{0x10f51, 0x10f59, AL},
-{0x10f70, 0x10f81, R},
-{0x10f82, 0x10f85, NSM},
-{0x10f86, 0x10f89, R},
-{0x10fb0, 0x10fcb, R},
-{0x10fe0, 0x10ff6, R},
-{0x11000, 0x11000, L},
-{0x11001, 0x11001, NSM},
-{0x11002, 0x11037, L},
-{0x11038, 0x11046, NSM},
-{0x11047, 0x1104d, L},
-{0x11066, 0x1106f, L},
-{0x11070, 0x11070, NSM},
-{0x11071, 0x11072, L},
-{0x11073, 0x11074, NSM},
-{0x11075, 0x11075, L},
-{0x1107f, 0x11081, NSM},
-{0x11082, 0x110b2, L},
-{0x110b3, 0x110b6, NSM},
-{0x110b7, 0x110b8, L},
-{0x110b9, 0x110ba, NSM},
-{0x110bb, 0x110c1, L},
-{0x110c2, 0x110c2, NSM},
-{0x110cd, 0x110cd, L},
-{0x110d0, 0x110e8, L},
-{0x110f0, 0x110f9, L},
-{0x11100, 0x11102, NSM},
-{0x11103, 0x11126, L},
-{0x11127, 0x1112b, NSM},
-{0x1112c, 0x1112c, L},
-{0x1112d, 0x11134, NSM},
-{0x11136, 0x11147, L},
-{0x11150, 0x11172, L},
-{0x11173, 0x11173, NSM},
-{0x11174, 0x11176, L},
-{0x11180, 0x11181, NSM},
-{0x11182, 0x111b5, L},
-{0x111b6, 0x111be, NSM},
-{0x111bf, 0x111c8, L},
-{0x111c9, 0x111cc, NSM},
-{0x111cd, 0x111ce, L},
-{0x111cf, 0x111cf, NSM},
-{0x111d0, 0x111df, L},
-{0x111e1, 0x111f4, L},
-{0x11200, 0x11211, L},
-{0x11213, 0x1122e, L},
-{0x1122f, 0x11231, NSM},
-{0x11232, 0x11233, L},
-{0x11234, 0x11234, NSM},
-{0x11235, 0x11235, L},
-{0x11236, 0x11237, NSM},
-{0x11238, 0x1123d, L},
-{0x1123e, 0x1123e, NSM},
-{0x1123f, 0x11240, L},
-{0x11241, 0x11241, NSM},
-{0x11280, 0x11286, L},
-{0x11288, 0x11288, L},
-{0x1128a, 0x1128d, L},
-{0x1128f, 0x1129d, L},
-{0x1129f, 0x112a9, L},
-{0x112b0, 0x112de, L},
-{0x112df, 0x112df, NSM},
-{0x112e0, 0x112e2, L},
-{0x112e3, 0x112ea, NSM},
-{0x112f0, 0x112f9, L},
-{0x11300, 0x11301, NSM},
-{0x11302, 0x11303, L},
-{0x11305, 0x1130c, L},
-{0x1130f, 0x11310, L},
-{0x11313, 0x11328, L},
-{0x1132a, 0x11330, L},
-{0x11332, 0x11333, L},
-{0x11335, 0x11339, L},
-{0x1133b, 0x1133c, NSM},
-{0x1133d, 0x1133f, L},
-{0x11340, 0x11340, NSM},
-{0x11341, 0x11344, L},
-{0x11347, 0x11348, L},
-{0x1134b, 0x1134d, L},
-{0x11350, 0x11350, L},
-{0x11357, 0x11357, L},
-{0x1135d, 0x11363, L},
-{0x11366, 0x1136c, NSM},
-{0x11370, 0x11374, NSM},
-{0x11380, 0x11389, L},
-{0x1138b, 0x1138b, L},
-{0x1138e, 0x1138e, L},
-{0x11390, 0x113b5, L},
-{0x113b7, 0x113ba, L},
-{0x113bb, 0x113c0, NSM},
-{0x113c2, 0x113c2, L},
-{0x113c5, 0x113c5, L},
-{0x113c7, 0x113ca, L},
-{0x113cc, 0x113cd, L},
-{0x113ce, 0x113ce, NSM},
-{0x113cf, 0x113cf, L},
-{0x113d0, 0x113d0, NSM},
-{0x113d1, 0x113d1, L},
-{0x113d2, 0x113d2, NSM},
-{0x113d3, 0x113d5, L},
-{0x113d7, 0x113d8, L},
-{0x113e1, 0x113e2, NSM},
-{0x11400, 0x11437, L},
-{0x11438, 0x1143f, NSM},
-{0x11440, 0x11441, L},
-{0x11442, 0x11444, NSM},
-{0x11445, 0x11445, L},
-{0x11446, 0x11446, NSM},
-{0x11447, 0x1145b, L},
-{0x1145d, 0x1145d, L},
-{0x1145e, 0x1145e, NSM},
-{0x1145f, 0x11461, L},
-{0x11480, 0x114b2, L},
-{0x114b3, 0x114b8, NSM},
-{0x114b9, 0x114b9, L},
-{0x114ba, 0x114ba, NSM},
-{0x114bb, 0x114be, L},
-{0x114bf, 0x114c0, NSM},
-{0x114c1, 0x114c1, L},
-{0x114c2, 0x114c3, NSM},
-{0x114c4, 0x114c7, L},
-{0x114d0, 0x114d9, L},
-{0x11580, 0x115b1, L},
-{0x115b2, 0x115b5, NSM},
-{0x115b8, 0x115bb, L},
-{0x115bc, 0x115bd, NSM},
-{0x115be, 0x115be, L},
-{0x115bf, 0x115c0, NSM},
-{0x115c1, 0x115db, L},
-{0x115dc, 0x115dd, NSM},
-{0x11600, 0x11632, L},
-{0x11633, 0x1163a, NSM},
-{0x1163b, 0x1163c, L},
-{0x1163d, 0x1163d, NSM},
-{0x1163e, 0x1163e, L},
-{0x1163f, 0x11640, NSM},
-{0x11641, 0x11644, L},
-{0x11650, 0x11659, L},
-{0x11680, 0x116aa, L},
-{0x116ab, 0x116ab, NSM},
-{0x116ac, 0x116ac, L},
-{0x116ad, 0x116ad, NSM},
-{0x116ae, 0x116af, L},
-{0x116b0, 0x116b5, NSM},
-{0x116b6, 0x116b6, L},
-{0x116b7, 0x116b7, NSM},
-{0x116b8, 0x116b9, L},
-{0x116c0, 0x116c9, L},
-{0x116d0, 0x116e3, L},
-{0x11700, 0x1171a, L},
-{0x1171d, 0x1171d, NSM},
-{0x1171e, 0x1171e, L},
-{0x1171f, 0x1171f, NSM},
-{0x11720, 0x11721, L},
-{0x11722, 0x11725, NSM},
-{0x11726, 0x11726, L},
-{0x11727, 0x1172b, NSM},
-{0x11730, 0x11746, L},
-{0x11800, 0x1182e, L},
-{0x1182f, 0x11837, NSM},
-{0x11838, 0x11838, L},
-{0x11839, 0x1183a, NSM},
-{0x1183b, 0x1183b, L},
-{0x118a0, 0x118f2, L},
-{0x118ff, 0x11906, L},
-{0x11909, 0x11909, L},
-{0x1190c, 0x11913, L},
-{0x11915, 0x11916, L},
-{0x11918, 0x11935, L},
-{0x11937, 0x11938, L},
-{0x1193b, 0x1193c, NSM},
-{0x1193d, 0x1193d, L},
-{0x1193e, 0x1193e, NSM},
-{0x1193f, 0x11942, L},
-{0x11943, 0x11943, NSM},
-{0x11944, 0x11946, L},
-{0x11950, 0x11959, L},
-{0x119a0, 0x119a7, L},
-{0x119aa, 0x119d3, L},
-{0x119d4, 0x119d7, NSM},
-{0x119da, 0x119db, NSM},
-{0x119dc, 0x119df, L},
-{0x119e0, 0x119e0, NSM},
-{0x119e1, 0x119e4, L},
-{0x11a00, 0x11a00, L},
-{0x11a01, 0x11a06, NSM},
-{0x11a07, 0x11a08, L},
-{0x11a09, 0x11a0a, NSM},
-{0x11a0b, 0x11a32, L},
-{0x11a33, 0x11a38, NSM},
-{0x11a39, 0x11a3a, L},
-{0x11a3b, 0x11a3e, NSM},
-{0x11a3f, 0x11a46, L},
-{0x11a47, 0x11a47, NSM},
-{0x11a50, 0x11a50, L},
-{0x11a51, 0x11a56, NSM},
-{0x11a57, 0x11a58, L},
-{0x11a59, 0x11a5b, NSM},
-{0x11a5c, 0x11a89, L},
-{0x11a8a, 0x11a96, NSM},
-{0x11a97, 0x11a97, L},
-{0x11a98, 0x11a99, NSM},
-{0x11a9a, 0x11aa2, L},
-{0x11ab0, 0x11af8, L},
-{0x11b00, 0x11b09, L},
-{0x11bc0, 0x11be1, L},
-{0x11bf0, 0x11bf9, L},
-{0x11c00, 0x11c08, L},
-{0x11c0a, 0x11c2f, L},
-{0x11c30, 0x11c36, NSM},
-{0x11c38, 0x11c3d, NSM},
-{0x11c3e, 0x11c45, L},
-{0x11c50, 0x11c6c, L},
-{0x11c70, 0x11c8f, L},
-{0x11c92, 0x11ca7, NSM},
-{0x11ca9, 0x11ca9, L},
-{0x11caa, 0x11cb0, NSM},
-{0x11cb1, 0x11cb1, L},
-{0x11cb2, 0x11cb3, NSM},
-{0x11cb4, 0x11cb4, L},
-{0x11cb5, 0x11cb6, NSM},
-{0x11d00, 0x11d06, L},
-{0x11d08, 0x11d09, L},
-{0x11d0b, 0x11d30, L},
-{0x11d31, 0x11d36, NSM},
-{0x11d3a, 0x11d3a, NSM},
-{0x11d3c, 0x11d3d, NSM},
-{0x11d3f, 0x11d45, NSM},
-{0x11d46, 0x11d46, L},
-{0x11d47, 0x11d47, NSM},
-{0x11d50, 0x11d59, L},
-{0x11d60, 0x11d65, L},
-{0x11d67, 0x11d68, L},
-{0x11d6a, 0x11d8e, L},
-{0x11d90, 0x11d91, NSM},
-{0x11d93, 0x11d94, L},
-{0x11d95, 0x11d95, NSM},
-{0x11d96, 0x11d96, L},
-{0x11d97, 0x11d97, NSM},
-{0x11d98, 0x11d98, L},
-{0x11da0, 0x11da9, L},
-{0x11ee0, 0x11ef2, L},
-{0x11ef3, 0x11ef4, NSM},
-{0x11ef5, 0x11ef8, L},
-{0x11f00, 0x11f01, NSM},
-{0x11f02, 0x11f10, L},
-{0x11f12, 0x11f35, L},
-{0x11f36, 0x11f3a, NSM},
-{0x11f3e, 0x11f3f, L},
-{0x11f40, 0x11f40, NSM},
-{0x11f41, 0x11f41, L},
-{0x11f42, 0x11f42, NSM},
-{0x11f43, 0x11f59, L},
-{0x11f5a, 0x11f5a, NSM},
-{0x11fb0, 0x11fb0, L},
-{0x11fc0, 0x11fd4, L},
-{0x11fdd, 0x11fe0, ET},
-{0x11fff, 0x12399, L},
-{0x12400, 0x1246e, L},
-{0x12470, 0x12474, L},
-{0x12480, 0x12543, L},
-{0x12f90, 0x12ff2, L},
-{0x13000, 0x1343f, L},
-{0x13440, 0x13440, NSM},
-{0x13441, 0x13446, L},
-{0x13447, 0x13455, NSM},
-{0x13460, 0x143fa, L},
-{0x14400, 0x14646, L},
-{0x16100, 0x1611d, L},
-{0x1611e, 0x16129, NSM},
-{0x1612a, 0x1612c, L},
-{0x1612d, 0x1612f, NSM},
-{0x16130, 0x16139, L},
-{0x16800, 0x16a38, L},
-{0x16a40, 0x16a5e, L},
-{0x16a60, 0x16a69, L},
-{0x16a6e, 0x16abe, L},
-{0x16ac0, 0x16ac9, L},
-{0x16ad0, 0x16aed, L},
-{0x16af0, 0x16af4, NSM},
-{0x16af5, 0x16af5, L},
-{0x16b00, 0x16b2f, L},
-{0x16b30, 0x16b36, NSM},
-{0x16b37, 0x16b45, L},
-{0x16b50, 0x16b59, L},
-{0x16b5b, 0x16b61, L},
-{0x16b63, 0x16b77, L},
-{0x16b7d, 0x16b8f, L},
-{0x16d40, 0x16d79, L},
-{0x16e40, 0x16e9a, L},
-{0x16f00, 0x16f4a, L},
-{0x16f4f, 0x16f4f, NSM},
-{0x16f50, 0x16f87, L},
-{0x16f8f, 0x16f92, NSM},
-{0x16f93, 0x16f9f, L},
-{0x16fe0, 0x16fe1, L},
-{0x16fe3, 0x16fe3, L},
-{0x16fe4, 0x16fe4, NSM},
-{0x16ff0, 0x16ff1, L},
-{0x17000, 0x187f7, L},
-{0x18800, 0x18cd5, L},
-{0x18cff, 0x18d08, L},
-{0x1aff0, 0x1aff3, L},
-{0x1aff5, 0x1affb, L},
-{0x1affd, 0x1affe, L},
-{0x1b000, 0x1b122, L},
-{0x1b132, 0x1b132, L},
-{0x1b150, 0x1b152, L},
-{0x1b155, 0x1b155, L},
-{0x1b164, 0x1b167, L},
-{0x1b170, 0x1b2fb, L},
-{0x1bc00, 0x1bc6a, L},
-{0x1bc70, 0x1bc7c, L},
-{0x1bc80, 0x1bc88, L},
-{0x1bc90, 0x1bc99, L},
-{0x1bc9c, 0x1bc9c, L},
-{0x1bc9d, 0x1bc9e, NSM},
-{0x1bc9f, 0x1bc9f, L},
-{0x1bca0, 0x1bca3, BN},
-{0x1ccd6, 0x1ccef, L},
-{0x1ccf0, 0x1ccf9, EN},
-{0x1cf00, 0x1cf2d, NSM},
-{0x1cf30, 0x1cf46, NSM},
-{0x1cf50, 0x1cfc3, L},
-{0x1d000, 0x1d0f5, L},
-{0x1d100, 0x1d126, L},
-{0x1d129, 0x1d166, L},
-{0x1d167, 0x1d169, NSM},
-{0x1d16a, 0x1d172, L},
-{0x1d173, 0x1d17a, BN},
-{0x1d17b, 0x1d182, NSM},
-{0x1d183, 0x1d184, L},
-{0x1d185, 0x1d18b, NSM},
-{0x1d18c, 0x1d1a9, L},
-{0x1d1aa, 0x1d1ad, NSM},
-{0x1d1ae, 0x1d1e8, L},
-{0x1d242, 0x1d244, NSM},
-{0x1d2c0, 0x1d2d3, L},
-{0x1d2e0, 0x1d2f3, L},
-{0x1d360, 0x1d378, L},
-{0x1d400, 0x1d454, L},
-{0x1d456, 0x1d49c, L},
-{0x1d49e, 0x1d49f, L},
-{0x1d4a2, 0x1d4a2, L},
-{0x1d4a5, 0x1d4a6, L},
-{0x1d4a9, 0x1d4ac, L},
-{0x1d4ae, 0x1d4b9, L},
-{0x1d4bb, 0x1d4bb, L},
-{0x1d4bd, 0x1d4c3, L},
-{0x1d4c5, 0x1d505, L},
-{0x1d507, 0x1d50a, L},
-{0x1d50d, 0x1d514, L},
-{0x1d516, 0x1d51c, L},
-{0x1d51e, 0x1d539, L},
-{0x1d53b, 0x1d53e, L},
-{0x1d540, 0x1d544, L},
-{0x1d546, 0x1d546, L},
-{0x1d54a, 0x1d550, L},
-{0x1d552, 0x1d6a5, L},
-{0x1d6a8, 0x1d6c0, L},
-{0x1d6c2, 0x1d6da, L},
-{0x1d6dc, 0x1d6fa, L},
-{0x1d6fc, 0x1d714, L},
-{0x1d716, 0x1d734, L},
-{0x1d736, 0x1d74e, L},
-{0x1d750, 0x1d76e, L},
-{0x1d770, 0x1d788, L},
-{0x1d78a, 0x1d7a8, L},
-{0x1d7aa, 0x1d7c2, L},
-{0x1d7c4, 0x1d7cb, L},
-{0x1d7ce, 0x1d7ff, EN},
-{0x1d800, 0x1d9ff, L},
-{0x1da00, 0x1da36, NSM},
-{0x1da37, 0x1da3a, L},
-{0x1da3b, 0x1da6c, NSM},
-{0x1da6d, 0x1da74, L},
-{0x1da75, 0x1da75, NSM},
-{0x1da76, 0x1da83, L},
-{0x1da84, 0x1da84, NSM},
-{0x1da85, 0x1da8b, L},
-{0x1da9b, 0x1da9f, NSM},
-{0x1daa1, 0x1daaf, NSM},
-{0x1df00, 0x1df1e, L},
-{0x1df25, 0x1df2a, L},
-{0x1e000, 0x1e006, NSM},
-{0x1e008, 0x1e018, NSM},
-{0x1e01b, 0x1e021, NSM},
-{0x1e023, 0x1e024, NSM},
-{0x1e026, 0x1e02a, NSM},
-{0x1e030, 0x1e06d, L},
-{0x1e08f, 0x1e08f, NSM},
-{0x1e100, 0x1e12c, L},
-{0x1e130, 0x1e136, NSM},
-{0x1e137, 0x1e13d, L},
-{0x1e140, 0x1e149, L},
-{0x1e14e, 0x1e14f, L},
-{0x1e290, 0x1e2ad, L},
-{0x1e2ae, 0x1e2ae, NSM},
-{0x1e2c0, 0x1e2eb, L},
-{0x1e2ec, 0x1e2ef, NSM},
-{0x1e2f0, 0x1e2f9, L},
-{0x1e2ff, 0x1e2ff, ET},
-{0x1e4d0, 0x1e4eb, L},
-{0x1e4ec, 0x1e4ef, NSM},
-{0x1e4f0, 0x1e4f9, L},
-{0x1e5d0, 0x1e5ed, L},
-{0x1e5ee, 0x1e5ef, NSM},
-{0x1e5f0, 0x1e5fa, L},
-{0x1e5ff, 0x1e5ff, L},
-{0x1e7e0, 0x1e7e6, L},
-{0x1e7e8, 0x1e7eb, L},
-{0x1e7ed, 0x1e7ee, L},
-{0x1e7f0, 0x1e7fe, L},
-{0x1e800, 0x1e8c4, R},
-{0x1e8c7, 0x1e8cf, R},
-{0x1e8d0, 0x1e8d6, NSM},
-{0x1e900, 0x1e943, R},
-{0x1e944, 0x1e94a, NSM},
-{0x1e94b, 0x1e94b, R},
-{0x1e950, 0x1e959, R},
-{0x1e95e, 0x1e95f, R},
-{0x1ec71, 0x1ecb4, AL},
-{0x1ed01, 0x1ed3d, AL},
-{0x1ee00, 0x1ee03, AL},
-{0x1ee05, 0x1ee1f, AL},
-{0x1ee21, 0x1ee22, AL},
-{0x1ee24, 0x1ee24, AL},
-{0x1ee27, 0x1ee27, AL},
-{0x1ee29, 0x1ee32, AL},
-{0x1ee34, 0x1ee37, AL},
-{0x1ee39, 0x1ee39, AL},
-{0x1ee3b, 0x1ee3b, AL},
-{0x1ee42, 0x1ee42, AL},
-{0x1ee47, 0x1ee47, AL},
-{0x1ee49, 0x1ee49, AL},
-{0x1ee4b, 0x1ee4b, AL},
-{0x1ee4d, 0x1ee4f, AL},
-{0x1ee51, 0x1ee52, AL},
-{0x1ee54, 0x1ee54, AL},
-{0x1ee57, 0x1ee57, AL},
-{0x1ee59, 0x1ee59, AL},
-{0x1ee5b, 0x1ee5b, AL},
-{0x1ee5d, 0x1ee5d, AL},
-{0x1ee5f, 0x1ee5f, AL},
-{0x1ee61, 0x1ee62, AL},
-{0x1ee64, 0x1ee64, AL},
-{0x1ee67, 0x1ee6a, AL},
-{0x1ee6c, 0x1ee72, AL},
-{0x1ee74, 0x1ee77, AL},
-{0x1ee79, 0x1ee7c, AL},
-{0x1ee7e, 0x1ee7e, AL},
-{0x1ee80, 0x1ee89, AL},
-{0x1ee8b, 0x1ee9b, AL},
-{0x1eea1, 0x1eea3, AL},
-{0x1eea5, 0x1eea9, AL},
-{0x1eeab, 0x1eebb, AL},
-{0x1f100, 0x1f10a, EN},
-{0x1f110, 0x1f12e, L},
-{0x1f130, 0x1f169, L},
-{0x1f170, 0x1f1ac, L},
-{0x1f1e6, 0x1f202, L},
-{0x1f210, 0x1f23b, L},
-{0x1f240, 0x1f248, L},
-{0x1f250, 0x1f251, L},
-{0x1fbf0, 0x1fbf9, EN},
-{0x20000, 0x2a6df, L},
-{0x2a700, 0x2b739, L},
-{0x2b740, 0x2b81d, L},
-{0x2b820, 0x2cea1, L},
-{0x2ceb0, 0x2ebe0, L},
-{0x2ebf0, 0x2ee5d, L},
-{0x2f800, 0x2fa1d, L},
-{0x30000, 0x3134a, L},
-{0x31350, 0x323af, L},
-{0xe0001, 0xe0001, BN},
-{0xe0020, 0xe007f, BN},
-{0xe0100, 0xe01ef, NSM},
-{0xf0000, 0xffffd, L},
-{0x100000, 0x10fffd, L},
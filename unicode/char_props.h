@@ -0,0 +1,1258 @@
+/*
+ * Autogenerated by read_ucd.py from The Unicode Standard 16.0.0
+ *
+ * Terminal width class, bidirectional type, mirroring and canonical
+ * combining class of every Unicode character, as a three-stage lookup
+ * table so that all of them can be found with a fixed number of array
+ * indexing operations.
+ *
+ * The distinct combinations of properties are listed once each in
+ * unicode_props_records[]. A code point c is looked up by indexing
+ * unicode_props_top[] with c >> UNICODE_PROPS_SHIFT1, then the
+ * resulting row of unicode_props_middle[] with the next bits down to
+ * UNICODE_PROPS_SHIFT2, then the resulting row of unicode_props_leaf[]
+ * with the bits below that, to get an index into unicode_props_records[].
+ * Code points beyond the end of the table have the properties in
+ * record 0.
+ *
+ * Used by utils/unicode-props.c.
+ */
+
+#define UNICODE_PROPS_SHIFT1 8
+#define UNICODE_PROPS_SHIFT2 4
+#define UNICODE_PROPS_LIMIT 0x110000
+
+static const UnicodeProps unicode_props_records[] = {
+    /*   0 */ {0, ON, 0},
+    /*   1 */ {0, BN, 0},
+    /*   2 */ {0, S, 0},
+    /*   3 */ {0, B, 0},
+    /*   4 */ {0, WS, 0},
+    /*   5 */ {0, ET, 0},
+    /*   6 */ {UPROP_MIRRORED, ON, 0},
+    /*   7 */ {0, ES, 0},
+    /*   8 */ {0, CS, 0},
+    /*   9 */ {0, EN, 0},
+    /*  10 */ {0, L, 0},
+    /*  11 */ {UPROP_AMBIGUOUS, ON, 0},
+    /*  12 */ {UPROP_AMBIGUOUS, ET, 0},
+    /*  13 */ {UPROP_AMBIGUOUS, L, 0},
+    /*  14 */ {UPROP_AMBIGUOUS, BN, 0},
+    /*  15 */ {UPROP_AMBIGUOUS, EN, 0},
+    /*  16 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 230},
+    /*  17 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 232},
+    /*  18 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 220},
+    /*  19 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 216},
+    /*  20 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 202},
+    /*  21 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 1},
+    /*  22 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 240},
+    /*  23 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 0},
+    /*  24 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 233},
+    /*  25 */ {UPROP_NONSPACING|UPROP_AMBIGUOUS, NSM, 234},
+    /*  26 */ {UPROP_NONSPACING, NSM, 230},
+    /*  27 */ {UPROP_NONSPACING, NSM, 0},
+    /*  28 */ {UPROP_NONSPACING, NSM, 220},
+    /*  29 */ {UPROP_NONSPACING, NSM, 222},
+    /*  30 */ {UPROP_NONSPACING, NSM, 228},
+    /*  31 */ {UPROP_NONSPACING, NSM, 10},
+    /*  32 */ {UPROP_NONSPACING, NSM, 11},
+    /*  33 */ {UPROP_NONSPACING, NSM, 12},
+    /*  34 */ {UPROP_NONSPACING, NSM, 13},
+    /*  35 */ {UPROP_NONSPACING, NSM, 14},
+    /*  36 */ {UPROP_NONSPACING, NSM, 15},
+    /*  37 */ {UPROP_NONSPACING, NSM, 16},
+    /*  38 */ {UPROP_NONSPACING, NSM, 17},
+    /*  39 */ {UPROP_NONSPACING, NSM, 18},
+    /*  40 */ {UPROP_NONSPACING, NSM, 19},
+    /*  41 */ {UPROP_NONSPACING, NSM, 20},
+    /*  42 */ {UPROP_NONSPACING, NSM, 21},
+    /*  43 */ {UPROP_NONSPACING, NSM, 22},
+    /*  44 */ {0, R, 0},
+    /*  45 */ {UPROP_NONSPACING, NSM, 23},
+    /*  46 */ {UPROP_NONSPACING, NSM, 24},
+    /*  47 */ {UPROP_NONSPACING, NSM, 25},
+    /*  48 */ {UPROP_NONSPACING, AN, 0},
+    /*  49 */ {0, AL, 0},
+    /*  50 */ {UPROP_NONSPACING, NSM, 30},
+    /*  51 */ {UPROP_NONSPACING, NSM, 31},
+    /*  52 */ {UPROP_NONSPACING, NSM, 32},
+    /*  53 */ {UPROP_NONSPACING, AL, 0},
+    /*  54 */ {UPROP_NONSPACING, NSM, 27},
+    /*  55 */ {UPROP_NONSPACING, NSM, 28},
+    /*  56 */ {UPROP_NONSPACING, NSM, 29},
+    /*  57 */ {UPROP_NONSPACING, NSM, 33},
+    /*  58 */ {UPROP_NONSPACING, NSM, 34},
+    /*  59 */ {0, AN, 0},
+    /*  60 */ {UPROP_NONSPACING, NSM, 35},
+    /*  61 */ {UPROP_NONSPACING, NSM, 36},
+    /*  62 */ {UPROP_NONSPACING, NSM, 7},
+    /*  63 */ {UPROP_NONSPACING, NSM, 9},
+    /*  64 */ {UPROP_NONSPACING, NSM, 84},
+    /*  65 */ {UPROP_NONSPACING, NSM, 91},
+    /*  66 */ {UPROP_NONSPACING, L, 0},
+    /*  67 */ {UPROP_NONSPACING, NSM, 103},
+    /*  68 */ {UPROP_NONSPACING, NSM, 107},
+    /*  69 */ {UPROP_NONSPACING, NSM, 118},
+    /*  70 */ {UPROP_NONSPACING, NSM, 122},
+    /*  71 */ {UPROP_NONSPACING, NSM, 216},
+    /*  72 */ {UPROP_NONSPACING, NSM, 129},
+    /*  73 */ {UPROP_NONSPACING, NSM, 130},
+    /*  74 */ {UPROP_NONSPACING, NSM, 132},
+    /*  75 */ {UPROP_WIDE, L, 0},
+    /*  76 */ {0, L, 9},
+    /*  77 */ {UPROP_NONSPACING, BN, 0},
+    /*  78 */ {UPROP_NONSPACING, NSM, 1},
+    /*  79 */ {UPROP_NONSPACING, NSM, 234},
+    /*  80 */ {UPROP_NONSPACING, NSM, 214},
+    /*  81 */ {UPROP_NONSPACING, NSM, 202},
+    /*  82 */ {UPROP_NONSPACING, NSM, 232},
+    /*  83 */ {UPROP_NONSPACING, NSM, 218},
+    /*  84 */ {UPROP_NONSPACING, NSM, 233},
+    /*  85 */ {UPROP_NONSPACING, R, 0},
+    /*  86 */ {UPROP_NONSPACING, LRE, 0},
+    /*  87 */ {UPROP_NONSPACING, RLE, 0},
+    /*  88 */ {UPROP_NONSPACING, PDF, 0},
+    /*  89 */ {UPROP_NONSPACING, LRO, 0},
+    /*  90 */ {UPROP_NONSPACING, RLO, 0},
+    /*  91 */ {UPROP_NONSPACING, LRI, 0},
+    /*  92 */ {UPROP_NONSPACING, RLI, 0},
+    /*  93 */ {UPROP_NONSPACING, FSI, 0},
+    /*  94 */ {UPROP_NONSPACING, PDI, 0},
+    /*  95 */ {UPROP_AMBIGUOUS|UPROP_MIRRORED, ON, 0},
+    /*  96 */ {UPROP_WIDE, ON, 0},
+    /*  97 */ {UPROP_WIDE|UPROP_MIRRORED, ON, 0},
+    /*  98 */ {UPROP_WIDE, WS, 0},
+    /*  99 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 218},
+    /* 100 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 228},
+    /* 101 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 232},
+    /* 102 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 222},
+    /* 103 */ {UPROP_WIDE, L, 224},
+    /* 104 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 8},
+    /* 105 */ {UPROP_NONSPACING, NSM, 26},
+    /* 106 */ {UPROP_WIDE, CS, 0},
+    /* 107 */ {UPROP_WIDE, ET, 0},
+    /* 108 */ {UPROP_WIDE, ES, 0},
+    /* 109 */ {UPROP_WIDE, EN, 0},
+    /* 110 */ {UPROP_NONSPACING, ON, 0},
+    /* 111 */ {UPROP_NONSPACING, L, 9},
+    /* 112 */ {UPROP_NONSPACING|UPROP_WIDE, NSM, 0},
+    /* 113 */ {UPROP_WIDE, L, 6},
+    /* 114 */ {0, L, 216},
+    /* 115 */ {0, L, 226},
+};
+
+static const unsigned char unicode_props_top[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 21, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 21, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 52, 21, 53, 54, 55, 56, 57, 58, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 59, 21, 21, 21, 21, 21, 21, 21, 21,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 50, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 21, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    21, 21, 21, 98, 99, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 102,
+    21, 21, 21, 21, 103, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 104, 21, 21, 105, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 106, 101, 101, 101, 101, 101, 101, 21, 21, 107, 108, 101, 109, 110, 111,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 112, 50, 50, 50, 50, 113, 114, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 115,
+    50, 116, 117, 101, 101, 101, 101, 101, 101, 101, 101, 101, 118, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 119, 101, 101, 120,
+    121, 122, 123, 124, 125, 126, 127, 128, 21, 21, 129, 101, 101, 101, 101, 130,
+    131, 132, 133, 101, 134, 135, 101, 136, 137, 138, 101, 101, 139, 140, 141, 101,
+    142, 143, 144, 145, 146, 147, 148, 149, 101, 150, 151, 152, 101, 101, 101, 101,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 153, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 154, 155, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 156, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 157, 50, 50, 158, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 50, 50, 160, 159, 159, 159, 159, 161,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 162, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 163, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 161,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    164, 165, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 166,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 166,
+};
+
+static const unsigned short unicode_props_middle[][16] = {
+    {0, 1, 2, 3, 4, 5, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14},
+    {15, 16, 17, 18, 19, 20, 17, 21, 21, 21, 21, 21, 22, 23, 21, 21},
+    {21, 21, 21, 21, 21, 15, 15, 21, 21, 21, 21, 24, 25, 26, 27, 28},
+    {29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 38, 40, 21, 21, 41},
+    {15, 42, 42, 42, 42, 15, 21, 21, 43, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 4, 21, 44, 21, 21, 45, 46, 47, 48, 49, 50, 51, 52},
+    {53, 54, 55, 55, 56, 57, 58, 59, 55, 55, 55, 55, 55, 60, 61, 62},
+    {63, 64, 55, 65, 66, 55, 55, 55, 55, 55, 67, 68, 50, 50, 69, 70},
+    {50, 71, 72, 73, 50, 74, 75, 55, 76, 77, 55, 55, 78, 79, 80, 81},
+    {82, 21, 21, 83, 84, 85, 86, 21, 87, 88, 89, 90, 91, 92, 93, 94},
+    {95, 88, 89, 96, 97, 98, 99, 100, 101, 102, 89, 103, 104, 105, 93, 106},
+    {107, 88, 89, 108, 109, 110, 93, 111, 112, 113, 114, 115, 116, 117, 99, 118},
+    {119, 120, 89, 121, 122, 123, 93, 124, 125, 120, 89, 126, 127, 128, 93, 129},
+    {130, 120, 21, 131, 132, 133, 93, 21, 134, 135, 21, 136, 137, 138, 99, 139},
+    {4, 21, 21, 140, 141, 142, 28, 28, 143, 21, 144, 145, 146, 147, 28, 28},
+    {21, 148, 21, 149, 150, 21, 151, 152, 153, 154, 155, 156, 157, 158, 28, 28},
+    {21, 21, 159, 160, 21, 161, 162, 163, 164, 165, 21, 21, 166, 21, 21, 21},
+    {167, 167, 167, 167, 167, 167, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168},
+    {21, 21, 21, 21, 169, 170, 21, 21, 169, 21, 21, 171, 172, 173, 21, 21},
+    {21, 172, 21, 21, 21, 174, 21, 151, 21, 28, 21, 21, 21, 21, 21, 175},
+    {4, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 21, 21, 21, 176, 177, 21, 21, 21, 21, 21, 178},
+    {21, 179, 21, 180, 21, 181, 182, 183, 21, 21, 21, 184, 185, 186, 187, 28},
+    {188, 187, 21, 21, 21, 21, 21, 178, 189, 21, 190, 21, 21, 21, 21, 191},
+    {21, 192, 193, 194, 99, 21, 195, 196, 21, 21, 142, 21, 187, 158, 28, 28},
+    {21, 197, 21, 21, 21, 198, 199, 200, 187, 187, 195, 201, 202, 28, 28, 28},
+    {203, 21, 21, 204, 205, 21, 206, 207, 208, 21, 209, 21, 21, 21, 210, 211},
+    {21, 21, 212, 213, 214, 21, 21, 21, 158, 21, 21, 215, 111, 216, 217, 218},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 219, 220, 221, 222},
+    {21, 175, 21, 21, 175, 223, 21, 195, 21, 21, 21, 224, 225, 226, 151, 225},
+    {227, 228, 229, 230, 231, 232, 233, 234, 235, 151, 236, 237, 238, 239, 240, 241},
+    {242, 243, 244, 147, 245, 246, 247, 248, 249, 250, 28, 251, 28, 252, 253, 28},
+    {254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269},
+    {270, 271, 272, 99, 21, 21, 21, 158, 28, 273, 28, 28, 28, 28, 274, 275},
+    {28, 28, 28, 28, 28, 28, 276, 276, 277, 278, 42, 42, 42, 42, 279, 276},
+    {276, 276, 276, 276, 280, 276, 276, 281, 276, 282, 283, 284, 285, 286, 287, 288},
+    {289, 290, 28, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303},
+    {304, 28, 305, 306, 307, 308, 309, 310, 28, 311, 28, 312, 313, 314, 315, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 316, 317, 318, 319, 320, 321, 322, 323},
+    {28, 28, 324, 325, 28, 28, 326, 327, 261, 261, 328, 261, 261, 329, 330, 331},
+    {28, 332, 28, 28, 28, 333, 28, 28, 28, 28, 28, 28, 28, 28, 28, 334},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 335, 336},
+    {21, 21, 166, 21, 21, 21, 337, 338, 21, 339, 340, 340, 340, 340, 221, 221},
+    {341, 342, 343, 28, 28, 344, 28, 28, 345, 346, 345, 345, 345, 345, 345, 293},
+    {345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 347, 28, 345},
+    {348, 349, 350, 351, 352, 167, 167, 167, 167, 353, 354, 167, 167, 167, 167, 355},
+    {356, 167, 167, 352, 167, 167, 167, 167, 357, 167, 167, 167, 345, 345, 358, 167},
+    {167, 359, 167, 167, 360, 345, 167, 361, 167, 167, 167, 362, 363, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 364, 167, 167, 167, 167, 167, 365, 167, 366},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 345, 345, 345, 345},
+    {167, 167, 167, 167, 167, 167, 167, 167, 367, 345, 345, 345, 368, 21, 21, 21},
+    {151, 21, 142, 28, 21, 21, 369, 370, 21, 371, 21, 21, 21, 21, 21, 372},
+    {28, 28, 373, 21, 21, 21, 21, 21, 150, 21, 21, 21, 195, 374, 28, 373},
+    {375, 21, 376, 377, 21, 21, 21, 378, 21, 21, 21, 21, 379, 187, 221, 380},
+    {21, 21, 381, 21, 382, 383, 167, 367, 82, 21, 21, 384, 385, 115, 386, 192},
+    {21, 21, 387, 388, 389, 147, 21, 390, 21, 21, 21, 391, 392, 393, 394, 395},
+    {396, 397, 340, 21, 21, 21, 187, 21, 21, 21, 21, 21, 21, 21, 398, 187},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 399, 21, 400, 21, 21, 142},
+    {42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42},
+    {167, 167, 167, 167, 167, 167, 365, 167, 167, 167, 167, 167, 167, 401, 345, 345},
+    {339, 402, 403, 404, 405, 55, 55, 55, 55, 55, 55, 55, 406, 407, 55, 55},
+    {55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {55, 55, 55, 408, 28, 55, 55, 55, 55, 409, 55, 55, 410, 28, 28, 411},
+    {412, 413, 414, 345, 345, 415, 416, 417, 55, 55, 55, 55, 55, 55, 55, 418},
+    {419, 420, 354, 421, 354, 422, 423, 21, 21, 21, 21, 192, 424, 425, 426, 427},
+    {428, 21, 173, 429, 195, 195, 28, 28, 21, 21, 21, 21, 21, 21, 21, 158},
+    {430, 21, 21, 431, 28, 28, 28, 28, 432, 28, 28, 28, 28, 21, 21, 433},
+    {28, 28, 28, 28, 28, 28, 28, 28, 21, 151, 21, 21, 21, 105, 434, 435},
+    {21, 21, 436, 21, 158, 21, 21, 437, 21, 438, 21, 21, 439, 191, 28, 28},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 195, 187, 21, 21, 439, 21, 142},
+    {21, 21, 111, 21, 21, 21, 440, 441, 441, 442, 102, 443, 21, 21, 21, 378},
+    {21, 21, 21, 339, 21, 191, 111, 28, 41, 21, 21, 444, 28, 28, 28, 28},
+    {445, 50, 50, 446, 50, 447, 50, 50, 50, 73, 448, 28, 28, 28, 50, 449},
+    {50, 450, 50, 451, 28, 28, 28, 28, 50, 50, 50, 452, 50, 453, 50, 50},
+    {454, 455, 50, 456, 457, 457, 50, 50, 50, 50, 28, 28, 50, 50, 458, 459},
+    {50, 50, 50, 460, 50, 461, 50, 462, 50, 463, 464, 28, 28, 28, 28, 28},
+    {50, 50, 50, 50, 457, 28, 28, 28, 50, 50, 50, 465, 50, 50, 50, 466},
+    {55, 55, 467, 468, 469, 50, 470, 50, 471, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 472, 473, 50, 50, 474, 475, 476, 28, 28, 477},
+    {50, 50, 478, 55, 479, 480, 28, 50, 481, 28, 28, 50, 450, 28, 50, 459},
+    {482, 21, 21, 483, 484, 28, 99, 485, 208, 21, 21, 486, 487, 21, 178, 187},
+    {488, 21, 489, 490, 111, 21, 21, 491, 208, 21, 21, 492, 493, 21, 4, 196},
+    {21, 102, 494, 495, 496, 28, 28, 28, 497, 438, 187, 21, 21, 494, 498, 187},
+    {499, 88, 89, 500, 501, 502, 503, 504, 505, 21, 21, 506, 507, 508, 509, 28},
+    {21, 21, 21, 483, 510, 511, 512, 28, 21, 21, 21, 513, 514, 187, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 21, 21, 21, 515, 516, 517, 28, 28},
+    {21, 21, 21, 518, 519, 187, 28, 28, 21, 21, 520, 521, 187, 21, 378, 28},
+    {21, 522, 523, 21, 339, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {21, 21, 494, 524, 28, 28, 28, 28, 28, 28, 21, 21, 21, 21, 21, 525},
+    {526, 527, 21, 528, 491, 187, 28, 28, 28, 28, 529, 21, 21, 530, 531, 28},
+    {532, 21, 21, 533, 534, 535, 21, 21, 536, 537, 538, 21, 21, 21, 21, 178},
+    {187, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 21, 512, 187},
+    {89, 21, 21, 539, 191, 21, 151, 21, 21, 540, 541, 542, 28, 28, 28, 28},
+    {543, 21, 21, 544, 545, 187, 546, 21, 192, 547, 187, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 548},
+    {208, 120, 21, 549, 550, 551, 28, 28, 28, 28, 28, 105, 21, 552, 238, 553},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 187, 28, 28, 28, 28, 28, 28},
+    {21, 21, 21, 21, 21, 21, 192, 196, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 378, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 21, 21, 21, 21, 21, 538},
+    {21, 21, 21, 168, 554, 555, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 158},
+    {21, 21, 21, 21, 339, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {21, 556, 557, 187, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {21, 21, 21, 178, 21, 192, 115, 21, 21, 21, 21, 192, 187, 21, 195, 558},
+    {21, 21, 21, 559, 191, 560, 102, 561, 21, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 21, 21, 21, 187, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 21, 21, 21, 21, 21, 158, 28, 28, 28, 28, 28, 28},
+    {21, 21, 21, 21, 562, 21, 21, 21, 563, 82, 28, 28, 28, 28, 564, 565},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 566},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 567, 28, 568},
+    {569, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 570},
+    {167, 167, 571, 572, 28, 573, 574, 167, 167, 167, 167, 167, 167, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 575},
+    {21, 21, 21, 21, 21, 21, 158, 151, 178, 576, 577, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 99, 21, 578},
+    {155, 155, 579, 155, 580, 21, 21, 21, 21, 21, 21, 21, 378, 28, 28, 28},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 191},
+    {21, 21, 44, 21, 21, 21, 581, 582, 583, 21, 584, 21, 21, 21, 178, 28},
+    {28, 28, 28, 28, 585, 28, 28, 28, 28, 28, 28, 28, 21, 378, 21, 378},
+    {345, 345, 345, 345, 345, 368, 167, 586, 28, 28, 28, 28, 28, 28, 28, 28},
+    {21, 21, 21, 21, 21, 587, 21, 21, 21, 182, 588, 589, 590, 21, 21, 21},
+    {591, 592, 21, 593, 594, 120, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 595, 21, 120, 441, 21, 441},
+    {21, 587, 21, 587, 192, 21, 192, 21, 89, 21, 89, 21, 596, 597, 597, 597},
+    {155, 155, 155, 598, 155, 155, 599, 386, 600, 601, 602, 28, 28, 28, 28, 28},
+    {21, 192, 603, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {604, 605, 606, 21, 21, 21, 195, 28, 607, 28, 28, 28, 28, 28, 28, 28},
+    {21, 21, 151, 608, 115, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 609, 28, 21, 21, 610, 45},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 611, 187},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 612, 613},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 614, 192},
+    {50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 615, 616, 28, 28},
+    {50, 50, 50, 50, 617, 618, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 619, 55, 55, 55, 620, 28, 28, 28, 28},
+    {619, 55, 55, 408, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {621, 55, 622, 623, 624, 625, 626, 627, 628, 629, 630, 629, 28, 28, 28, 28},
+    {631, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 295, 28, 28, 28},
+    {632, 42, 633, 42, 42, 42, 634, 42, 635, 636, 637, 28, 28, 28, 99, 21},
+    {571, 167, 167, 575, 569, 638, 347, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {345, 345, 639, 640, 345, 345, 345, 641, 345, 293, 345, 345, 642, 293, 345, 643},
+    {345, 345, 345, 644, 645, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 646},
+    {345, 345, 345, 647, 648, 345, 291, 649, 28, 650, 631, 28, 28, 28, 28, 651},
+    {345, 345, 345, 345, 345, 28, 28, 28, 345, 345, 345, 345, 652, 653, 332, 654},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 655, 656},
+    {657, 345, 345, 658, 640, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345},
+    {28, 28, 28, 28, 28, 28, 28, 659, 660, 345, 345, 345, 661, 646, 413, 662},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 578},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 345, 345},
+    {167, 167, 167, 401, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167},
+    {167, 365, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 663, 167, 167, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 362, 167},
+    {167, 167, 167, 167, 167, 365, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345},
+    {345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345},
+    {167, 365, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345},
+    {345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 647},
+    {167, 167, 167, 167, 664, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167},
+    {167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 345, 345, 345, 345, 345},
+    {665, 28, 666, 666, 666, 666, 666, 666, 28, 28, 28, 28, 28, 28, 28, 28},
+    {412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 28},
+    {42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 667},
+};
+
+static const unsigned char unicode_props_leaf[][16] = {
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 4, 3, 1, 1},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 2},
+    {4, 0, 0, 5, 5, 5, 0, 0, 6, 6, 0, 7, 8, 7, 8, 8},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 0, 6, 0, 6, 0},
+    {0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 0, 6, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 0, 6, 0, 1},
+    {1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {8, 11, 5, 5, 12, 5, 0, 11, 11, 0, 13, 6, 0, 14, 11, 0},
+    {12, 12, 15, 15, 11, 10, 11, 11, 11, 15, 13, 6, 11, 11, 11, 11},
+    {10, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {13, 10, 10, 10, 10, 10, 10, 11, 13, 10, 10, 10, 10, 10, 13, 13},
+    {13, 13, 10, 10, 10, 10, 13, 10, 13, 13, 13, 10, 13, 13, 10, 10},
+    {13, 10, 13, 13, 10, 10, 10, 11, 13, 13, 13, 10, 13, 10, 13, 10},
+    {10, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 13, 10, 13, 10, 10, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 13, 13, 10, 10, 10, 13, 10, 10, 10, 10},
+    {10, 13, 13, 13, 10, 10, 10, 10, 13, 10, 10, 10, 10, 10, 10, 13},
+    {13, 13, 13, 10, 13, 10, 10, 10, 13, 13, 13, 13, 10, 13, 10, 10},
+    {10, 10, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 10},
+    {13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10},
+    {10, 10, 0, 0, 11, 0, 0, 11, 0, 11, 11, 11, 0, 11, 0, 0},
+    {13, 10, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 0, 11, 0, 11},
+    {10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {16, 16, 16, 16, 16, 17, 18, 18, 18, 18, 17, 19, 18, 18, 18, 18},
+    {18, 20, 20, 18, 18, 18, 18, 20, 20, 18, 18, 18, 18, 18, 18, 18},
+    {18, 18, 18, 18, 21, 21, 21, 21, 21, 18, 18, 18, 18, 16, 16, 16},
+    {16, 16, 16, 16, 16, 22, 16, 18, 18, 18, 16, 16, 16, 18, 18, 23},
+    {16, 16, 16, 18, 18, 18, 18, 16, 17, 18, 18, 16, 24, 25, 25, 24},
+    {25, 25, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {10, 10, 10, 10, 0, 0, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10},
+    {0, 0, 0, 0, 0, 0, 10, 0, 10, 10, 10, 0, 10, 0, 10, 10},
+    {10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+    {13, 13, 0, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10},
+    {13, 13, 10, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+    {10, 10, 10, 26, 26, 26, 26, 26, 27, 27, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 5},
+    {0, 28, 26, 26, 26, 26, 28, 26, 26, 26, 29, 28, 26, 26, 26, 26},
+    {26, 26, 28, 28, 28, 28, 28, 28, 26, 26, 28, 26, 26, 29, 30, 26},
+    {31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45},
+    {44, 46, 47, 44, 26, 28, 44, 39, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 44},
+    {44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {48, 48, 48, 48, 48, 48, 0, 0, 49, 5, 5, 49, 8, 49, 0, 0},
+    {26, 26, 26, 26, 26, 26, 26, 26, 50, 51, 52, 49, 53, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 54, 55, 56, 50, 51},
+    {52, 57, 58, 26, 26, 28, 28, 26, 26, 26, 26, 26, 28, 26, 26, 28},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 5, 59, 59, 49, 49, 49},
+    {60, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 26, 26, 26, 26, 26, 26, 26, 48, 0, 26},
+    {26, 26, 26, 28, 26, 49, 49, 26, 26, 0, 28, 26, 26, 28, 49, 49},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 53},
+    {49, 61, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {26, 28, 26, 26, 28, 26, 26, 28, 28, 28, 26, 28, 28, 26, 28, 26},
+    {26, 26, 28, 26, 28, 26, 28, 26, 28, 26, 26, 0, 0, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 26, 26, 26, 26, 26},
+    {26, 26, 28, 26, 44, 44, 0, 0, 0, 0, 44, 0, 0, 28, 44, 44},
+    {44, 44, 44, 44, 44, 44, 26, 26, 26, 26, 44, 26, 26, 26, 26, 26},
+    {26, 26, 26, 26, 44, 26, 26, 26, 44, 26, 26, 26, 26, 26, 0, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 28, 28, 28, 0, 0, 44, 0},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0},
+    {48, 48, 0, 0, 0, 0, 0, 26, 26, 28, 28, 28, 26, 26, 26, 26},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 26, 26, 26, 26, 26, 28},
+    {28, 28, 28, 28, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26},
+    {26, 26, 48, 28, 26, 26, 28, 26, 26, 28, 26, 26, 26, 28, 28, 28},
+    {54, 55, 56, 26, 26, 26, 28, 26, 26, 28, 28, 26, 26, 26, 26, 26},
+    {27, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 10, 62, 10, 10, 10},
+    {10, 27, 27, 27, 27, 27, 27, 27, 27, 10, 10, 10, 10, 63, 10, 10},
+    {10, 26, 28, 26, 26, 27, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 27, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10},
+    {10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10},
+    {10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 0, 0, 62, 10, 10, 10},
+    {10, 27, 27, 27, 27, 0, 0, 10, 10, 0, 0, 10, 10, 63, 10, 0},
+    {0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 10, 10, 0, 10},
+    {10, 10, 27, 27, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 5, 5, 10, 10, 10, 10, 10, 10, 10, 5, 10, 10, 26, 0},
+    {0, 27, 27, 10, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10},
+    {10, 0, 10, 10, 0, 10, 10, 0, 10, 10, 0, 0, 62, 0, 10, 10},
+    {10, 27, 27, 0, 0, 0, 0, 27, 27, 0, 0, 27, 27, 63, 0, 0},
+    {0, 27, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 0, 10, 0},
+    {0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {27, 27, 10, 10, 10, 27, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 27, 27, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10},
+    {10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 62, 10, 10, 10},
+    {10, 27, 27, 27, 27, 27, 0, 27, 27, 10, 0, 10, 10, 63, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 5, 0, 0, 0, 0, 0, 0, 0, 10, 27, 27, 27, 27, 27, 27},
+    {0, 27, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10},
+    {10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 62, 10, 10, 27},
+    {10, 27, 27, 27, 27, 0, 0, 10, 10, 0, 0, 10, 10, 63, 0, 0},
+    {0, 0, 0, 0, 0, 27, 27, 10, 0, 0, 0, 0, 10, 10, 0, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 27, 10, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10},
+    {10, 0, 10, 10, 10, 10, 0, 0, 0, 10, 10, 0, 10, 0, 10, 10},
+    {0, 0, 0, 10, 10, 0, 0, 0, 10, 10, 10, 0, 0, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10},
+    {27, 10, 10, 0, 0, 0, 10, 10, 10, 0, 10, 10, 10, 63, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0},
+    {27, 10, 10, 10, 27, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 62, 10, 27, 27},
+    {27, 10, 10, 10, 10, 0, 27, 27, 27, 0, 27, 27, 27, 63, 0, 0},
+    {0, 0, 0, 0, 0, 64, 65, 0, 10, 10, 10, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 62, 10, 10, 66},
+    {10, 10, 10, 10, 10, 0, 66, 10, 10, 0, 10, 10, 27, 63, 0, 0},
+    {0, 0, 0, 0, 0, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 0},
+    {0, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 63, 63, 10, 10, 10},
+    {10, 27, 27, 27, 27, 0, 10, 10, 10, 0, 10, 10, 10, 63, 10, 10},
+    {0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {0, 27, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10},
+    {10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 63, 0, 0, 0, 0, 10},
+    {10, 10, 27, 27, 27, 0, 27, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {0, 0, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 27, 10, 10, 27, 27, 27, 27, 67, 67, 63, 0, 0, 0, 0, 5},
+    {10, 10, 10, 10, 10, 10, 10, 27, 68, 68, 68, 68, 27, 27, 27, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0},
+    {0, 10, 10, 0, 10, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10},
+    {10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 27, 10, 10, 27, 27, 27, 27, 69, 69, 63, 27, 27, 10, 0, 0},
+    {10, 10, 10, 10, 10, 0, 10, 0, 70, 70, 70, 70, 27, 27, 27, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 28, 28, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 28, 10, 28, 10, 71, 6, 6, 6, 6, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0},
+    {0, 72, 73, 27, 74, 27, 27, 27, 27, 27, 73, 73, 73, 73, 27, 10},
+    {73, 27, 26, 26, 63, 10, 26, 26, 10, 10, 10, 10, 10, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 0, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 28, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 27},
+    {27, 10, 27, 27, 27, 27, 27, 62, 10, 63, 63, 10, 10, 27, 27, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 10, 10, 10, 10, 27, 27},
+    {27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 27, 27, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 27, 10, 10, 27, 27, 10, 10, 10, 10, 10, 10, 28, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 10, 10},
+    {10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 0, 10, 0, 0},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75},
+    {66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 0},
+    {10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0},
+    {10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 26, 26, 26},
+    {10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0},
+    {4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 6, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 27, 27, 63, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 10, 27, 27, 76, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 0, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 27, 27, 10, 27, 27, 27, 27, 27, 27, 27, 10, 10},
+    {10, 10, 10, 10, 10, 10, 27, 10, 10, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 63, 27, 10, 10, 10, 10, 10, 10, 10, 5, 10, 26, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 77, 27},
+    {10, 10, 10, 10, 10, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 30, 10, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0},
+    {27, 27, 27, 10, 10, 10, 10, 27, 27, 10, 10, 10, 0, 0, 0, 0},
+    {10, 10, 27, 10, 10, 10, 10, 10, 10, 29, 26, 28, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0},
+    {10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 26, 28, 10, 10, 27, 0, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 27, 10, 27, 27, 27, 27, 27, 27, 27, 0},
+    {63, 10, 27, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27, 10, 10, 10},
+    {10, 10, 10, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 28},
+    {26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 26, 26, 28, 27, 28},
+    {28, 26, 26, 28, 28, 26, 26, 26, 26, 26, 28, 26, 26, 26, 26, 0},
+    {27, 27, 27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 62, 10, 27, 27, 27, 27, 27, 10, 27, 10, 10, 10},
+    {10, 10, 27, 10, 76, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 28, 26, 26, 26},
+    {26, 26, 26, 26, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {27, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 27, 27, 27, 27, 10, 10, 27, 27, 76, 63, 27, 27, 10, 10},
+    {10, 10, 10, 10, 10, 10, 62, 10, 27, 27, 10, 10, 10, 27, 10, 27},
+    {27, 27, 76, 76, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27},
+    {27, 27, 27, 27, 10, 10, 27, 62, 0, 0, 0, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10},
+    {26, 26, 26, 10, 78, 28, 28, 28, 28, 28, 26, 26, 28, 28, 28, 28},
+    {26, 10, 78, 78, 78, 78, 78, 78, 78, 10, 10, 10, 10, 28, 10, 10},
+    {10, 10, 10, 10, 26, 10, 10, 10, 26, 26, 10, 0, 0, 0, 0, 0},
+    {26, 26, 28, 26, 26, 26, 26, 26, 26, 26, 28, 26, 26, 79, 80, 28},
+    {81, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26},
+    {26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26},
+    {26, 26, 26, 26, 26, 26, 82, 30, 30, 28, 83, 26, 84, 28, 26, 28},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 0, 10, 0, 10},
+    {10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0},
+    {0, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0},
+    {10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0},
+    {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 77, 77, 77, 66, 85},
+    {11, 0, 0, 11, 11, 11, 11, 0, 11, 11, 0, 0, 11, 11, 0, 0},
+    {11, 11, 11, 0, 11, 11, 11, 11, 4, 3, 86, 87, 88, 89, 90, 8},
+    {12, 5, 12, 12, 5, 11, 0, 0, 0, 6, 6, 11, 0, 0, 11, 0},
+    {0, 0, 0, 0, 8, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
+    {77, 77, 77, 77, 77, 0, 91, 92, 93, 94, 77, 77, 77, 77, 77, 77},
+    {9, 10, 0, 0, 15, 9, 9, 9, 9, 9, 7, 7, 0, 6, 6, 13},
+    {9, 15, 15, 15, 15, 9, 9, 9, 9, 9, 7, 7, 0, 6, 6, 0},
+    {5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5, 5, 5},
+    {5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    {5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {26, 26, 78, 78, 26, 26, 26, 26, 78, 78, 78, 26, 26, 27, 27, 27},
+    {27, 26, 27, 27, 27, 78, 78, 26, 28, 26, 78, 78, 28, 28, 28, 28},
+    {26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 10, 11, 0, 11, 0, 10, 0, 11, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 13, 0, 10, 11, 0, 0, 10, 10, 10, 10, 10, 0, 0},
+    {0, 11, 11, 0, 10, 0, 13, 0, 10, 0, 10, 13, 10, 10, 5, 10},
+    {0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10},
+    {0, 0, 0, 11, 11, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 0},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 0},
+    {11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 0, 0, 0, 0, 0, 0},
+    {0, 0, 11, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 0, 11, 11, 0, 0, 0, 11, 95, 6, 6, 95, 6, 6, 0, 11},
+    {0, 11, 7, 5, 0, 95, 0, 0, 0, 0, 11, 0, 0, 11, 11, 95},
+    {95, 6, 6, 11, 6, 11, 0, 11, 11, 11, 11, 11, 11, 0, 11, 0},
+    {0, 0, 0, 0, 11, 11, 11, 11, 0, 0, 0, 0, 95, 95, 0, 0},
+    {0, 0, 0, 6, 0, 6, 0, 0, 11, 0, 0, 0, 95, 0, 0, 0},
+    {0, 0, 95, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 11, 0, 0, 95, 95, 95, 95, 6, 6, 95, 95, 0, 0, 95, 95},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 95, 95, 6, 6, 95, 95, 6, 6, 6, 6, 0, 0, 0, 6},
+    {6, 6, 6, 0, 0, 11, 0, 0, 6, 11, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 6, 0, 11, 6, 0, 6, 6, 0, 6, 0, 0, 0, 0},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0, 0},
+    {6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0},
+    {6, 6, 6, 6, 6, 0, 6, 6, 0, 0, 6, 6, 6, 6, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0},
+    {0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 96, 96, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 97, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 0, 0, 0},
+    {96, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 11, 11, 11, 15, 15, 15, 15, 15, 15, 15, 15},
+    {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 13, 13, 13, 13},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0},
+    {11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0},
+    {0, 0, 11, 11, 0, 0, 11, 11, 0, 0, 0, 0, 11, 11, 0, 0},
+    {11, 11, 0, 0, 0, 0, 11, 11, 11, 0, 0, 11, 0, 0, 11, 11},
+    {11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 0},
+    {0, 0, 0, 0, 0, 11, 11, 0, 0, 11, 0, 0, 0, 0, 11, 11},
+    {0, 0, 0, 0, 96, 96, 0, 0, 0, 0, 0, 0, 11, 0, 11, 0},
+    {96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 0, 11, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {11, 11, 0, 11, 11, 11, 0, 11, 11, 11, 11, 0, 11, 11, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96},
+    {0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11},
+    {0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 11},
+    {0, 0, 0, 0, 96, 96, 11, 11, 11, 11, 11, 11, 11, 11, 96, 11},
+    {11, 11, 11, 11, 96, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 0, 11, 0, 0, 0, 0, 11, 11, 96, 11, 11, 11, 11, 11},
+    {11, 11, 96, 96, 11, 96, 11, 11, 11, 11, 96, 11, 11, 96, 11, 11},
+    {0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 96, 96, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 96, 0},
+    {0, 0, 0, 96, 96, 96, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {0, 0, 0, 0, 0, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0},
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96},
+    {0, 0, 0, 6, 6, 6, 6, 0, 6, 6, 0, 6, 0, 6, 0, 0},
+    {0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6, 6, 0},
+    {0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6, 0, 0, 0, 0},
+    {6, 0, 0, 6, 6, 6, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {6, 6, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {6, 6, 6, 0, 6, 6, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 6, 6, 0, 0, 6, 6, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0},
+    {0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0},
+    {0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 6, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6},
+    {6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 0, 0, 0},
+    {96, 0, 0, 0, 0, 96, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 26},
+    {26, 26, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0},
+    {0, 0, 6, 6, 6, 6, 0, 0, 0, 6, 6, 0, 6, 6, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {98, 96, 96, 96, 96, 75, 75, 75, 97, 97, 97, 97, 97, 97, 97, 97},
+    {97, 97, 96, 96, 97, 97, 97, 97, 97, 97, 97, 97, 96, 96, 96, 96},
+    {96, 75, 75, 75, 75, 75, 75, 75, 75, 75, 99, 100, 101, 102, 103, 103},
+    {96, 75, 75, 75, 75, 75, 96, 96, 75, 75, 75, 75, 75, 96, 96, 0},
+    {0, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75},
+    {75, 75, 75, 75, 75, 75, 75, 0, 0, 104, 104, 96, 96, 75, 75, 75},
+    {96, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 75, 75, 75, 75},
+    {0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0},
+    {96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96, 0},
+    {75, 75, 75, 75, 75, 75, 75, 75, 13, 13, 13, 13, 13, 13, 13, 13},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96, 96, 75},
+    {75, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96, 96, 96},
+    {75, 75, 75, 75, 75, 75, 75, 96, 96, 96, 96, 75, 75, 75, 75, 75},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0},
+    {96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26},
+    {27, 27, 27, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 26},
+    {26, 26, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 0, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0},
+    {10, 10, 27, 10, 10, 10, 63, 10, 10, 10, 10, 27, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 27, 27, 10, 0, 0, 0, 0, 63, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 63, 27, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10},
+    {26, 26, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27},
+    {10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 28, 28, 28, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 10, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 10, 10, 62, 10, 10, 27, 27, 27, 27, 10, 10, 27, 27, 10, 10},
+    {76, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10},
+    {10, 10, 10, 10, 10, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27, 10},
+    {10, 27, 27, 10, 10, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 27, 10, 10, 10, 10, 10, 10, 10, 10, 27, 10, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 10, 10, 10},
+    {26, 10, 26, 26, 28, 10, 10, 26, 26, 10, 10, 10, 10, 10, 26, 26},
+    {10, 26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 10, 10},
+    {10, 10, 10, 10, 10, 10, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0},
+    {0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 27, 10, 10, 27, 10, 10, 10, 10, 63, 0, 0},
+    {75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96, 96, 96, 96, 96},
+    {0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 44, 105, 44},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 7, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 44, 0, 44, 44, 44, 44, 44, 0, 44, 0},
+    {44, 44, 0, 44, 44, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0},
+    {0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0},
+    {26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 26, 26},
+    {106, 96, 106, 0, 96, 106, 96, 96, 96, 97, 97, 97, 97, 97, 97, 107},
+    {96, 96, 108, 108, 97, 97, 96, 0, 96, 107, 107, 96, 0, 0, 0, 0},
+    {49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 77},
+    {0, 96, 96, 107, 107, 107, 96, 96, 97, 97, 96, 108, 106, 108, 106, 106},
+    {109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 106, 96, 97, 96, 97, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 97, 96, 97, 96, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 97, 96, 97, 96, 97},
+    {97, 0, 6, 6, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10},
+    {0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 0, 0, 0},
+    {107, 107, 96, 96, 96, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 110, 110, 0, 11, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10},
+    {10, 0, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 28, 0, 0},
+    {28, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0},
+    {10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10},
+    {10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10},
+    {10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0},
+    {10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 0, 0, 44, 0, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 0, 44, 44, 0, 0, 0, 44, 0, 0, 44},
+    {44, 44, 44, 44, 44, 44, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 0, 44, 44, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 44},
+    {44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 44, 44, 44, 44},
+    {0, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 27, 27, 27, 0, 27, 27, 0, 0, 0, 0, 0, 27, 28, 27, 26},
+    {44, 44, 44, 44, 0, 44, 44, 44, 0, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 0, 0, 26, 78, 28, 0, 0, 0, 0, 63},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 26, 28, 0, 0, 0, 0, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44},
+    {49, 49, 49, 49, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 0, 0, 0, 26, 26, 26, 26, 26, 0, 44},
+    {44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 26, 26, 44, 0, 0},
+    {44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 28, 28},
+    {44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0},
+    {49, 49, 49, 49, 49, 49, 28, 28, 26, 26, 26, 28, 26, 28, 28, 28},
+    {28, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0},
+    {44, 44, 26, 28, 26, 28, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0},
+    {10, 27, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 63, 10, 10, 10, 10, 10, 10, 10, 0, 0},
+    {63, 10, 10, 27, 27, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63},
+    {10, 10, 10, 27, 27, 27, 27, 10, 10, 63, 62, 10, 10, 66, 10, 10},
+    {10, 10, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0},
+    {26, 26, 26, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 10, 27, 27, 27},
+    {27, 27, 27, 63, 63, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 62, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27, 27, 10},
+    {76, 10, 10, 10, 10, 10, 10, 10, 10, 27, 62, 27, 27, 10, 10, 27},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27},
+    {27, 27, 10, 10, 27, 76, 62, 27, 10, 10, 10, 10, 10, 10, 27, 10},
+    {10, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10},
+    {10, 10, 10, 27, 27, 27, 27, 27, 27, 62, 63, 0, 0, 0, 0, 0},
+    {27, 27, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10},
+    {10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 62, 62, 10, 10, 10},
+    {27, 10, 10, 10, 10, 0, 0, 10, 10, 0, 0, 10, 10, 76, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 10, 10, 10},
+    {10, 10, 10, 10, 0, 0, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0},
+    {26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 10, 0},
+    {10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 27, 27, 27, 27, 27},
+    {27, 0, 10, 0, 0, 10, 0, 10, 10, 10, 10, 0, 10, 10, 63, 76},
+    {63, 10, 27, 10, 10, 10, 0, 10, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 63, 27, 27, 10, 62, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 26, 10},
+    {10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 27, 27, 27, 27, 27, 27, 10, 27, 10, 10, 10, 10, 27},
+    {27, 10, 63, 62, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 27, 27, 27, 27, 0, 0, 10, 10, 10, 10, 27, 27, 10, 63},
+    {62, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 0, 0},
+    {10, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27, 10, 10, 27, 10, 63},
+    {27, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 10, 27, 10, 10},
+    {27, 27, 27, 27, 27, 27, 76, 62, 10, 10, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 27, 10, 27},
+    {10, 10, 27, 27, 27, 27, 10, 27, 27, 27, 27, 63, 0, 0, 0, 0},
+    {27, 27, 27, 27, 27, 27, 27, 27, 10, 63, 62, 10, 0, 0, 0, 0},
+    {10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10},
+    {10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 0, 10, 10, 10, 10},
+    {10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 27, 27, 76, 63, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 27, 27, 27, 27, 0, 0, 27, 27, 10, 10, 10, 10},
+    {63, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 27, 27, 27, 27, 27, 27, 66, 66, 27, 27, 10, 10, 10, 10, 10},
+    {10, 10, 10, 27, 63, 27, 27, 27, 27, 10, 10, 27, 27, 27, 27, 10},
+    {10, 10, 10, 10, 10, 10, 10, 63, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 27, 27, 27, 27, 27, 27, 10, 10, 27, 27, 27, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 10, 27, 63, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {27, 27, 27, 27, 27, 27, 27, 0, 27, 27, 27, 27, 27, 27, 10, 111},
+    {0, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 0, 10, 27, 27, 27, 27, 27, 27},
+    {27, 10, 27, 27, 10, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10},
+    {10, 27, 27, 27, 27, 27, 27, 0, 0, 0, 27, 0, 27, 27, 0, 27},
+    {27, 27, 62, 27, 63, 63, 10, 27, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10},
+    {27, 27, 0, 10, 10, 27, 10, 63, 10, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 27, 27, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 0, 0, 0, 10, 10},
+    {27, 76, 63, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10},
+    {27, 10, 10, 10, 10, 10, 10, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 10, 10, 10, 27, 27, 63},
+    {78, 78, 78, 78, 78, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {26, 26, 26, 26, 26, 26, 26, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 27},
+    {10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 27},
+    {75, 75, 96, 75, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {113, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0, 75, 75, 0},
+    {75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 27, 78, 10},
+    {77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0},
+    {27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0},
+    {27, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 114, 114, 78, 78, 78, 10, 10, 10, 115, 114, 114},
+    {114, 114, 114, 77, 77, 77, 77, 77, 77, 77, 77, 28, 28, 28, 28, 28},
+    {28, 28, 28, 10, 10, 26, 26, 26, 26, 26, 28, 28, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 26, 26, 26, 10, 10},
+    {0, 0, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 75, 75, 75, 75, 75, 10, 10, 0, 0, 0, 0, 0, 0, 0},
+    {10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10},
+    {10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0},
+    {10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 9, 9},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+    {27, 27, 27, 27, 27, 27, 27, 10, 10, 10, 10, 27, 27, 27, 27, 27},
+    {27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 10, 10, 10},
+    {10, 10, 10, 10, 27, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 27, 27},
+    {0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0},
+    {26, 26, 26, 26, 26, 26, 26, 0, 26, 26, 26, 26, 26, 26, 26, 26},
+    {26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 26, 26, 26, 26, 26},
+    {26, 26, 0, 26, 26, 0, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26},
+    {26, 26, 26, 26, 26, 26, 26, 10, 10, 10, 10, 10, 10, 10, 0, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 0},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 26, 26, 26},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 82, 82, 28, 26},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 28},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10},
+    {10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 0},
+    {44, 44, 44, 44, 44, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {28, 28, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {44, 44, 44, 44, 26, 26, 26, 26, 26, 26, 62, 44, 0, 0, 0, 0},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 44, 44},
+    {0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {0, 49, 49, 0, 49, 0, 0, 49, 0, 49, 49, 49, 49, 49, 49, 49},
+    {49, 49, 49, 0, 49, 49, 49, 49, 0, 49, 0, 49, 0, 0, 0, 0},
+    {0, 0, 49, 0, 0, 0, 0, 49, 0, 49, 0, 49, 0, 49, 49, 49},
+    {0, 49, 49, 0, 49, 0, 0, 49, 0, 49, 0, 49, 0, 49, 0, 49},
+    {0, 49, 49, 0, 49, 0, 0, 49, 49, 49, 49, 0, 49, 49, 49, 49},
+    {49, 49, 49, 0, 49, 49, 49, 49, 0, 49, 49, 49, 49, 0, 49, 0},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49},
+    {49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0},
+    {0, 49, 49, 49, 0, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49},
+    {0, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 0},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 75, 13},
+    {13, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 13, 13, 13, 13, 13},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0},
+    {75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 96},
+    {96, 0, 0, 0, 96, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0},
+    {96, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 96, 0, 0, 0},
+    {96, 96, 96, 0, 0, 96, 96, 96, 0, 0, 0, 0, 96, 96, 96, 96},
+    {0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0},
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 96, 96, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 96},
+    {96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 96, 96},
+    {96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0},
+    {75, 75, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96},
+    {75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 96, 96, 96, 96, 96},
+    {0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77},
+    {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0},
+};
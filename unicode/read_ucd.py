@@ -57,6 +57,32 @@ def set_to_ranges(s):
     for r, _ in to_ranges((x, None) for x in sorted(s)):
         yield r
 
+def multistage_table(values, shift1, shift2):
+    """Compress a per-code-point list into a three-stage lookup table.
+
+    'values' is a list with an entry for every code point. It is cut
+    into leaf blocks of 2^shift2 entries, and the sequence of leaf
+    block indices is in turn cut into middle blocks each covering 2^shift1
+    code points. Identical blocks at both levels are stored only once.
+
+    Returns (top, middle, leaf): top[c >> shift1] is an index into
+    middle, whose entry (c >> shift2) % 2^(shift1-shift2) is an index
+    into leaf, whose entry c % 2^shift2 is values[c].
+    """
+    def dedup(seq, blocksize):
+        blocks, index, indices = [], {}, []
+        for i in range(0, len(seq), blocksize):
+            block = tuple(seq[i:i+blocksize])
+            if block not in index:
+                index[block] = len(blocks)
+                blocks.append(block)
+            indices.append(index[block])
+        return blocks, indices
+
+    leaf, leafidx = dedup(values, 1 << shift2)
+    middle, top = dedup(leafidx, 1 << (shift1 - shift2))
+    return top, middle, leaf
+
 def lines(iterable, keep_comments=False):
     """Deliver the lines of a Unicode data file.
 
@@ -97,26 +123,18 @@ class Main:
 
         with open("version.h", "w") as fh:
             self.write_version_header(fh)
-        with open("bidi_type.h", "w") as fh:
-            self.write_bidi_type_table(fh)
         with open("bidi_mirror.h", "w") as fh:
             self.write_bidi_mirroring_table(fh)
         with open("bidi_brackets.h", "w") as fh:
             self.write_bidi_brackets_table(fh)
-        with open("nonspacing_chars.h", "w") as fh:
-            self.write_nonspacing_chars_list(fh)
-        with open("wide_chars.h", "w") as fh:
-            self.write_wide_chars_list(fh)
-        with open("ambiguous_wide_chars.h", "w") as fh:
-            self.write_ambiguous_wide_chars_list(fh)
         with open("known_chars.h", "w") as fh:
             self.write_known_chars_table(fh)
-        with open("combining_classes.h", "w") as fh:
-            self.write_combining_class_table(fh)
         with open("canonical_decomp.h", "w") as fh:
             self.write_canonical_decomp_table(fh)
         with open("canonical_comp.h", "w") as fh:
             self.write_canonical_comp_table(fh)
+        with open("char_props.h", "w") as fh:
+            self.write_char_props_table(fh)
 
     def find_unicode_version(self):
         """Find out the version of Unicode.
@@ -260,6 +278,64 @@ class Main:
             for line in lines(fh):
                 yield int(line, 16)
 
+    @property
+    def bidi_types(self):
+        """Map from code point to bidi type, omitting type ON."""
+        types = {}
+        for rec in self.UnicodeData:
+            if rec.Bidi_Class != "ON":
+                types[rec.c] = rec.Bidi_Class
+        return types
+
+    @property
+    def bidi_mirror(self):
+        """Map from code point to its mirror-image counterpart."""
+        bidi_mirror = {}
+        for c1, c2 in self.BidiMirroring:
+            assert bidi_mirror.get(c1, c2) == c2, f"Clash at {c1:%04X}"
+            bidi_mirror[c1] = c2
+            assert bidi_mirror.get(c2, c1) == c1, f"Clash at {c2:%04X}"
+            bidi_mirror[c2] = c1
+        return bidi_mirror
+
+    @property
+    def nonspacing_chars(self):
+        """Set of code points that occupy no terminal character cells."""
+        cs = set()
+
+        for rec in self.UnicodeData:
+            nonspacing = rec.General_Category in {"Me", "Mn", "Cf"}
+            if rec.c == 0xAD:
+                # In typography this is a SOFT HYPHEN and counts as
+                # discardable. But it's also an ISO 8859-1 printing
+                # character, and all of those occupy one character
+                # cell in a terminal.
+                nonspacing = False
+            if 0x1160 <= rec.c <= 0x11FF:
+                # Medial (vowel) and final (consonant) jamo for
+                # decomposed Hangul characters. These are regarded as
+                # non-spacing on the grounds that they compose with
+                # the preceding initial consonant.
+                nonspacing = True
+            if nonspacing:
+                cs.add(rec.c)
+
+        return cs
+
+    def width_chars(self, accept):
+        """Set of code points whose East Asian width is in 'accept'."""
+        return set(c for c, wid in self.EastAsianWidth if wid in accept)
+
+    @property
+    def combining_classes(self):
+        """Map from code point to canonical combining class, if nonzero."""
+        cclasses = {}
+        for rec in self.UnicodeData:
+            cc = rec.Canonical_Combining_Class
+            if cc != 0:
+                cclasses[rec.c] = cc
+        return cclasses
+
     def write_file_header_comment(self, fh, description):
         print("/*", file=fh)
         print(" * Autogenerated by read_ucd.py from",
@@ -285,25 +361,6 @@ Useful for error messages and 'about' boxes.
         print("#define UNICODE_VERSION_SHORT \"{}\"".format(
             self.unicode_version_short), file=fh)
 
-    def write_bidi_type_table(self, fh):
-        self.write_file_header_comment(fh, """
-
-Bidirectional type of every Unicode character, excluding those with
-type ON.
-
-Used by terminal/bidi.c, whose associated lookup function returns ON
-by default for anything not in this list.
-
-""")
-        types = {}
-
-        for rec in self.UnicodeData:
-            if rec.Bidi_Class != "ON":
-                types[rec.c] = rec.Bidi_Class
-
-        for (start, end), t in map_to_ranges(types):
-            print(f"{{0x{start:04x}, 0x{end:04x}, {t}}},", file=fh)
-
     def write_bidi_mirroring_table(self, fh):
         self.write_file_header_comment(fh, """
 
@@ -313,14 +370,7 @@ left.
 Used by terminal/bidi.c.
 
 """)
-        bidi_mirror = {}
-        for c1, c2 in self.BidiMirroring:
-            assert bidi_mirror.get(c1, c2) == c2, f"Clash at {c1:%04X}"
-            bidi_mirror[c1] = c2
-            assert bidi_mirror.get(c2, c1) == c1, f"Clash at {c2:%04X}"
-            bidi_mirror[c2] = c1
-
-        for c1, c2 in sorted(bidi_mirror.items()):
+        for c1, c2 in sorted(self.bidi_mirror.items()):
             print("{{0x{:04x}, 0x{:04x}}},".format(c1, c2), file=fh)
 
     def write_bidi_brackets_table(self, fh):
@@ -355,70 +405,6 @@ Used by terminal/bidi.c.
             print("{{0x{:04x}, {{0x{:04x}, 0x{:04x}, {}}}}},".format(
                 src, dst, dsteq, enumval), file=fh)
 
-    def write_nonspacing_chars_list(self, fh):
-        self.write_file_header_comment(fh, """
-
-Identify Unicode characters that occupy no character cells of a
-terminal.
-
-Used by utils/wcwidth.c.
-
-""")
-        cs = set()
-
-        for rec in self.UnicodeData:
-            nonspacing = rec.General_Category in {"Me", "Mn", "Cf"}
-            if rec.c == 0xAD:
-                # In typography this is a SOFT HYPHEN and counts as
-                # discardable. But it's also an ISO 8859-1 printing
-                # character, and all of those occupy one character
-                # cell in a terminal.
-                nonspacing = False
-            if 0x1160 <= rec.c <= 0x11FF:
-                # Medial (vowel) and final (consonant) jamo for
-                # decomposed Hangul characters. These are regarded as
-                # non-spacing on the grounds that they compose with
-                # the preceding initial consonant.
-                nonspacing = True
-            if nonspacing:
-                cs.add(rec.c)
-
-        for start, end in set_to_ranges(cs):
-            print(f"{{0x{start:04x}, 0x{end:04x}}},", file=fh)
-
-    def write_width_table(self, fh, accept):
-        cs = set()
-
-        for c, wid in self.EastAsianWidth:
-            if wid in accept:
-                cs.add(c)
-
-        for start, end in set_to_ranges(cs):
-            print(f"{{0x{start:04x}, 0x{end:04x}}},", file=fh)
-
-    def write_wide_chars_list(self, fh):
-        self.write_file_header_comment(fh, """
-
-Identify Unicode characters that occupy two adjacent character cells
-in a terminal.
-
-Used by utils/wcwidth.c.
-
-""")
-        self.write_width_table(fh, {'W', 'F'})
-
-    def write_ambiguous_wide_chars_list(self, fh):
-        self.write_file_header_comment(fh, """
-
-Identify Unicode characters that are width-ambiguous: some regimes
-regard them as occupying two adjacent character cells in a terminal,
-and others do not.
-
-Used by utils/wcwidth.c.
-
-""")
-        self.write_width_table(fh, {'A'})
-
     def write_known_chars_table(self, fh):
         self.write_file_header_comment(fh, """
 
@@ -433,26 +419,6 @@ Used by utils/unicode-known.c.
         for start, end in set_to_ranges(chars):
             print(f"{{0x{start:04x}, 0x{end:04x}}},", file=fh)
 
-    def write_combining_class_table(self, fh):
-        self.write_file_header_comment(fh, """
-
-List the canonical combining class of each Unicode character, if it is
-not zero. This controls how combining marks can be reordered by the
-Unicode normalisation algorithms.
-
-Used by utils/unicode-norm.c.
-
-""")
-        cclasses = {}
-
-        for rec in self.UnicodeData:
-            cc = rec.Canonical_Combining_Class
-            if cc != 0:
-                cclasses[rec.c] = cc
-
-        for (start, end), cclass in map_to_ranges(cclasses):
-            print(f"{{0x{start:04x}, 0x{end:04x}, {cclass:d}}},", file=fh)
-
     def write_canonical_decomp_table(self, fh):
         self.write_file_header_comment(fh, """
 
@@ -506,5 +472,94 @@ Used by utils/unicode-norm.c.
         for (d0, d1), c in sorted(decomps.items()):
             print(f"{{0x{d0:04x}, 0x{d1:04x}, 0x{c:04x}}},", file=fh)
 
+    def write_char_props_table(self, fh):
+        self.write_file_header_comment(fh, """
+
+Terminal width class, bidirectional type, mirroring and canonical
+combining class of every Unicode character, as a three-stage lookup
+table so that all of them can be found with a fixed number of array
+indexing operations.
+
+The distinct combinations of properties are listed once each in
+unicode_props_records[]. A code point c is looked up by indexing
+unicode_props_top[] with c >> UNICODE_PROPS_SHIFT1, then the
+resulting row of unicode_props_middle[] with the next bits down to
+UNICODE_PROPS_SHIFT2, then the resulting row of unicode_props_leaf[]
+with the bits below that, to get an index into unicode_props_records[].
+Code points beyond the end of the table have the properties in
+record 0.
+
+Used by utils/unicode-props.c.
+
+""")
+        shift1, shift2 = 8, 4
+        nchars = 0x110000
+
+        nonspacing = self.nonspacing_chars
+        wide = self.width_chars({'W', 'F'})
+        ambiguous = self.width_chars({'A'})
+        mirror = self.bidi_mirror
+        types = self.bidi_types
+        cclasses = self.combining_classes
+
+        default = (0, "ON", 0)
+        records = {default: 0}
+        values = []
+        for c in range(nchars):
+            flags = ((1 if c in nonspacing else 0) |
+                     (2 if c in wide else 0) |
+                     (4 if c in ambiguous else 0) |
+                     (8 if c in mirror else 0))
+            props = flags, types.get(c, "ON"), cclasses.get(c, 0)
+            values.append(records.setdefault(props, len(records)))
+
+        top, middle, leaf = multistage_table(values, shift1, shift2)
+        assert len(records) <= 0x100 and len(leaf) <= 0x10000
+        assert len(middle) <= 0x100
+
+        flagnames = ["UPROP_NONSPACING", "UPROP_WIDE",
+                     "UPROP_AMBIGUOUS", "UPROP_MIRRORED"]
+
+        def rows(items, per_line):
+            for i in range(0, len(items), per_line):
+                yield " ".join(f"{x:d}," for x in items[i:i+per_line])
+
+        print(f"#define UNICODE_PROPS_SHIFT1 {shift1:d}", file=fh)
+        print(f"#define UNICODE_PROPS_SHIFT2 {shift2:d}", file=fh)
+        print(f"#define UNICODE_PROPS_LIMIT 0x{nchars:x}", file=fh)
+        print(file=fh)
+
+        print("static const UnicodeProps unicode_props_records[] = {",
+              file=fh)
+        for (flags, t, cclass), i in sorted(records.items(),
+                                            key=lambda kv: kv[1]):
+            flagstr = "|".join(name for bit, name in enumerate(flagnames)
+                               if flags & (1 << bit)) or "0"
+            print(f"    /* {i:3d} */ {{{flagstr}, {t}, {cclass:d}}},",
+                  file=fh)
+        print("};", file=fh)
+        print(file=fh)
+
+        print("static const unsigned char unicode_props_top[] = {", file=fh)
+        for row in rows(top, 16):
+            print("    " + row, file=fh)
+        print("};", file=fh)
+        print(file=fh)
+
+        print("static const unsigned short unicode_props_middle[][{:d}] = {{"
+              .format(1 << (shift1 - shift2)), file=fh)
+        for block in middle:
+            print("    {" + ", ".join(f"{x:d}" for x in block) + "},",
+                  file=fh)
+        print("};", file=fh)
+        print(file=fh)
+
+        print("static const unsigned char unicode_props_leaf[][{:d}] = {{"
+              .format(1 << shift2), file=fh)
+        for block in leaf:
+            print("    {" + ", ".join(f"{x:d}" for x in block) + "},",
+                  file=fh)
+        print("};", file=fh)
+
 if __name__ == '__main__':
     Main().run()
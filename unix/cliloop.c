@@ -44,9 +44,16 @@ void cli_main_loop(cliloop_pw_setup_t pw_setup,
             pollwrap_add_fd_rwx(pw, fd, rwx);
         }
 
+        /*
+         * Run any timers that are due first, because they might queue
+         * toplevel callbacks, in which case we mustn't block.
+         */
+        bool timers_pending = (!toplevel_callback_pending() &&
+                               run_timers(now, &next));
+
         if (toplevel_callback_pending()) {
             ret = pollwrap_poll_instant(pw);
-        } else if (run_timers(now, &next)) {
+        } else if (timers_pending) {
             do {
                 unsigned long then;
                 long ticks;
@@ -195,10 +195,12 @@
 #define STANDARD_OK_LABEL "_OK"
 #define STANDARD_OPEN_LABEL "_Open"
 #define STANDARD_CANCEL_LABEL "_Cancel"
+#define STANDARD_SAVE_LABEL "_Save"
 #else
 #define STANDARD_OK_LABEL GTK_STOCK_OK
 #define STANDARD_OPEN_LABEL GTK_STOCK_OPEN
 #define STANDARD_CANCEL_LABEL GTK_STOCK_CANCEL
+#define STANDARD_SAVE_LABEL GTK_STOCK_SAVE
 #endif
 
 #if GTK_CHECK_VERSION(3,0,0)
@@ -2,6 +2,15 @@
  * Unix networking abstraction.
  */
 
+#if HAVE_CMAKE_H
+#include "cmake.h"
+#endif
+
+#if HAVE_SPLICE
+#define _GNU_SOURCE                    /* for splice() */
+#include <features.h>
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
@@ -11,6 +20,7 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
@@ -89,9 +99,73 @@ struct NetSocket {
      */
     NetSocket *parent, *child;
 
+    /*
+     * While an outgoing connection is in progress, if the current
+     * attempt hasn't completed within CONNECT_ATTEMPT_DELAY we start
+     * a second one in parallel on the next candidate address, as
+     * recommended by RFC 8305 ('Happy Eyeballs'). 'racer' is that
+     * second attempt: a NetSocket of its own, with 'race_owner'
+     * pointing back here. Whichever attempt succeeds first ends up
+     * owning this socket's file descriptor.
+     */
+    NetSocket *racer, *race_owner;
+    bool race_addrs_exhausted;  /* a racer has tried the last address */
+    unsigned long race_timer;
+
+    size_t recv_size;                  /* how much to ask for per recv() */
+
+    /*
+     * If sk_net_splice has paired this socket with another, data we
+     * read is moved in the kernel into 'splice_pipe', and from there
+     * to 'splice_peer', without ever being passed to our plug.
+     * 'splice_pending' is how much is sitting in the pipe. If we see
+     * EOF while the pipe is non-empty, we don't tell the plug until
+     * it has drained, so that 'splice_eof' means the EOF is still to
+     * be reported.
+     */
+    NetSocket *splice_peer;
+    int splice_pipe[2];
+    size_t splice_pending;
+    bool splice_eof;
+
+    /* Counts of system calls and data, folded into net_stats on close */
+    NetSocketStats stats;
+
     Socket sock;
 };
 
+/*
+ * RFC 8305 recommends 250ms as the delay before starting the next
+ * connection attempt.
+ */
+#define CONNECT_ATTEMPT_DELAY (TICKSPERSEC / 4)
+
+/*
+ * Incoming data is read into a buffer shared between all sockets.
+ * Each socket starts off reading NET_RECV_MIN bytes at a time, and
+ * doubles that (up to NET_RECV_MAX) whenever a read fills the buffer,
+ * so that a bulk transfer is read in large chunks without every idle
+ * socket needing a large buffer of its own. In case we're ever
+ * re-entered while the shared buffer is in use, we fall back to a
+ * minimum-sized one on the stack.
+ */
+#define NET_RECV_MIN 20480
+#define NET_RECV_MAX 262144
+static char *net_recvbuf;
+static size_t net_recvbuf_size;
+static bool net_recvbuf_busy;
+
+/*
+ * Maximum number of bufchain granules we send with one sendmsg().
+ */
+#define NET_SEND_IOV 64
+
+/*
+ * Maximum number of connections we accept on a listening socket per
+ * readability notification.
+ */
+#define ACCEPT_BATCH 32
+
 struct SockAddr {
     int refcount;
     const char *error;
@@ -139,6 +213,13 @@ struct SockAddr {
 
 static tree234 *sktree;
 
+/* Totals over every NetSocket closed so far */
+static NetSocketStats net_stats;
+
+static void net_race_schedule(NetSocket *s);
+static void net_race_stop(NetSocket *s);
+static void net_splice_stop(NetSocket *s);
+
 static void uxsel_tell(NetSocket *s);
 
 static int cmpfortree(void *av, void *bv)
@@ -182,8 +263,57 @@ void sk_cleanup(void)
             close(s->s);
         }
     }
+
+    sfree(net_recvbuf);
+    net_recvbuf = NULL;
+    net_recvbuf_size = 0;
 }
 
+#ifndef NO_IPV6
+/*
+ * Reorder a getaddrinfo result so that address families alternate,
+ * starting with whichever family getaddrinfo preferred, as described
+ * in RFC 8305 section 4. That way, if one family's route to the host
+ * is broken, the parallel connection attempt started after
+ * CONNECT_ATTEMPT_DELAY will already be using the other one.
+ *
+ * The first entry (which carries ai_canonname) stays first, and every
+ * entry stays in the list, so freeaddrinfo is unaffected.
+ */
+static void interleave_address_families(struct addrinfo *ais)
+{
+    int first_family = ais->ai_family;
+    struct addrinfo *same = NULL, **same_tail = &same;
+    struct addrinfo *other = NULL, **other_tail = &other;
+
+    for (struct addrinfo *ai = ais->ai_next; ai; ai = ai->ai_next) {
+        if (ai->ai_family == first_family) {
+            *same_tail = ai;
+            same_tail = &ai->ai_next;
+        } else {
+            *other_tail = ai;
+            other_tail = &ai->ai_next;
+        }
+    }
+    *same_tail = *other_tail = NULL;
+
+    struct addrinfo **tail = &ais->ai_next;
+    while (same || other) {
+        if (other) {
+            *tail = other;
+            tail = &other->ai_next;
+            other = other->ai_next;
+        }
+        if (same) {
+            *tail = same;
+            tail = &same->ai_next;
+            same = same->ai_next;
+        }
+    }
+    *tail = NULL;
+}
+#endif
+
 SockAddr *sk_namelookup(const char *host, char **canonicalname,
                         int address_family)
 {
@@ -221,6 +351,8 @@ SockAddr *sk_namelookup(const char *host, char **canonicalname,
 
         if (addr->ais) {
             addr->superfamily = IP;
+            if (hints.ai_family == AF_UNSPEC)
+                interleave_address_families(addr->ais);
             if (addr->ais->ai_canonname)
                 *canonicalname = dupstr(addr->ais->ai_canonname);
             else
@@ -525,6 +657,14 @@ static Socket *sk_net_accept(accept_ctx_t ctx, Plug *plug)
     s->incomingeof = false;
     s->listener = false;
     s->parent = s->child = NULL;
+    s->racer = s->race_owner = NULL;
+    s->race_addrs_exhausted = false;
+    s->recv_size = NET_RECV_MIN;
+    s->splice_peer = NULL;
+    s->splice_pipe[0] = s->splice_pipe[1] = -1;
+    s->splice_pending = 0;
+    s->splice_eof = false;
+    memset(&s->stats, 0, sizeof(s->stats));
     s->addr = NULL;
     s->connected = true;
 
@@ -551,6 +691,8 @@ static int try_connect(NetSocket *sock)
     int err = 0;
     short localport;
     int salen, family;
+    /* A racing attempt reports its progress as its owner */
+    NetSocket *logsock = sock->race_owner ? sock->race_owner : sock;
 
     /*
      * Remove the socket from the tree before we overwrite its
@@ -566,7 +708,7 @@ static int try_connect(NetSocket *sock)
     {
         SockAddr thisaddr = sk_extractaddr_tmp(
             sock->addr, &sock->step);
-        plug_log(sock->plug, &sock->sock, PLUGLOG_CONNECT_TRYING,
+        plug_log(logsock->plug, &logsock->sock, PLUGLOG_CONNECT_TRYING,
                  &thisaddr, sock->port, NULL, 0);
     }
 
@@ -724,9 +866,12 @@ static int try_connect(NetSocket *sock)
         sock->connected = true;
         sock->writable = true;
 
-        SockAddr thisaddr = sk_extractaddr_tmp(sock->addr, &sock->step);
-        plug_log(sock->plug, &sock->sock, PLUGLOG_CONNECT_SUCCESS,
-                 &thisaddr, sock->port, NULL, 0);
+        /* (A racer's success is reported once its owner adopts it.) */
+        if (!sock->race_owner) {
+            SockAddr thisaddr = sk_extractaddr_tmp(sock->addr, &sock->step);
+            plug_log(sock->plug, &sock->sock, PLUGLOG_CONNECT_SUCCESS,
+                     &thisaddr, sock->port, NULL, 0);
+        }
     }
 
     uxsel_tell(sock);
@@ -741,12 +886,200 @@ static int try_connect(NetSocket *sock)
     if (err) {
         SockAddr thisaddr = sk_extractaddr_tmp(
             sock->addr, &sock->step);
-        plug_log(sock->plug, &sock->sock, PLUGLOG_CONNECT_FAILED,
+        plug_log(logsock->plug, &logsock->sock, PLUGLOG_CONNECT_FAILED,
                  &thisaddr, sock->port, strerror(err), err);
     }
     return err;
 }
 
+/*
+ * Called when an outgoing connection has completed, however it came
+ * about.
+ */
+static void net_connect_done(NetSocket *s)
+{
+    net_race_stop(s);
+    if (s->addr) {
+        sk_addr_free(s->addr);
+        s->addr = NULL;
+    }
+    s->connected = true;
+    s->writable = true;
+    uxsel_tell(s);
+}
+
+static void net_race_free(NetSocket *r)
+{
+    del234(sktree, r);
+    if (r->s >= 0) {
+        uxsel_del(r->s);
+        close(r->s);
+    }
+    sk_addr_free(r->addr);
+    sfree(r);
+}
+
+static void net_race_stop(NetSocket *s)
+{
+    if (s->racer) {
+        net_race_free(s->racer);
+        s->racer = NULL;
+    }
+    expire_timer_context(s);
+}
+
+/*
+ * Make the racing connection attempt into the owner's own, abandoning
+ * the owner's previous attempt (if it's still going).
+ */
+static void net_race_adopt(NetSocket *s)
+{
+    NetSocket *r = s->racer;
+    s->racer = NULL;
+
+    del234(sktree, s);
+    if (s->s >= 0) {
+        uxsel_del(s->s);
+        close(s->s);
+    }
+    del234(sktree, r);
+    uxsel_del(r->s);
+
+    s->s = r->s;
+    s->step = r->step;                 /* both point into s->addr */
+    s->connected = r->connected;
+    add234(sktree, s);
+
+    sk_addr_free(r->addr);
+    sfree(r);
+    uxsel_tell(s);
+}
+
+static void net_race_adopt_connected(NetSocket *s)
+{
+    net_race_adopt(s);
+
+    SockAddr thisaddr = sk_extractaddr_tmp(s->addr, &s->step);
+    plug_log(s->plug, &s->sock, PLUGLOG_CONNECT_SUCCESS,
+             &thisaddr, s->port, NULL, 0);
+    net_connect_done(s);
+}
+
+/*
+ * Start a racing connection attempt for s, on the first address after
+ * 'from' that we can get as far as an asynchronous connect() on.
+ */
+static void net_race_start(NetSocket *s, SockAddrStep from)
+{
+    NetSocket *r = snew(NetSocket);
+    memset(r, 0, sizeof(NetSocket));
+    r->sock.vt = &NetSocket_sockvt;
+    r->plug = s->plug;
+    bufchain_init(&r->output_data);
+    r->addr = sk_addr_dup(s->addr);
+    r->step = from;
+    r->s = -1;
+    r->oobinline = s->oobinline;
+    r->nodelay = s->nodelay;
+    r->keepalive = s->keepalive;
+    r->privport = s->privport;
+    r->port = s->port;
+    r->race_owner = s;
+
+    int err = 1;
+    while (err && sk_nextaddr(r->addr, &r->step))
+        err = try_connect(r);
+
+    if (err) {
+        s->race_addrs_exhausted = true;
+        net_race_free(r);
+        return;
+    }
+
+    s->racer = r;
+    if (r->connected)
+        net_race_adopt_connected(s);
+}
+
+static void net_race_callback(void *ctx)
+{
+    NetSocket *s = (NetSocket *)ctx;
+
+    if (s->connected || s->racer || !s->addr || s->race_addrs_exhausted)
+        return;
+
+    net_race_start(s, s->step);
+}
+
+static void net_race_timer(void *ctx, unsigned long now)
+{
+    NetSocket *s = (NetSocket *)ctx;
+
+    if (now != s->race_timer)
+        return;
+
+    /*
+     * Start the new attempt from a toplevel callback rather than
+     * directly: some event loops (e.g. cli_main_loop) have already
+     * collected the set of fds to wait on by the time they run
+     * timers, so they'd never notice the new socket.
+     */
+    queue_toplevel_callback(net_race_callback, s);
+}
+
+/*
+ * Arrange to start a racing attempt if the one we've just started on
+ * s doesn't complete in good time, provided there's an address left
+ * to race it with.
+ */
+static void net_race_schedule(NetSocket *s)
+{
+    if (s->connected || s->racer || !s->addr || s->race_addrs_exhausted)
+        return;
+
+    SockAddrStep next = s->step;
+    if (!sk_nextaddr(s->addr, &next))
+        return;
+
+    s->race_timer = schedule_timer(CONNECT_ATTEMPT_DELAY, net_race_timer, s);
+}
+
+/*
+ * Handle completion of a racing connection attempt.
+ */
+static void net_race_select_result(NetSocket *r)
+{
+    NetSocket *s = r->race_owner;
+    int err;
+    socklen_t errlen = sizeof(err);
+    char *errmsg = NULL;
+
+    assert(s->racer == r);
+
+    if (getsockopt(r->s, SOL_SOCKET, SO_ERROR, &err, &errlen) < 0) {
+        errmsg = dupprintf("getsockopt(SO_ERROR): %s", strerror(errno));
+        err = errno;
+    } else if (err != 0) {
+        errmsg = dupstr(strerror(err));
+    }
+
+    if (!errmsg) {
+        net_race_adopt_connected(s);
+        return;
+    }
+
+    SockAddr thisaddr = sk_extractaddr_tmp(r->addr, &r->step);
+    plug_log(s->plug, &s->sock, PLUGLOG_CONNECT_FAILED,
+             &thisaddr, r->port, errmsg, err);
+    sfree(errmsg);
+
+    /* Move straight on to the next address, if there is one. */
+    SockAddrStep from = r->step;
+    s->racer = NULL;
+    net_race_free(r);
+    net_race_start(s, from);
+}
+
 Socket *sk_new(SockAddr *addr, int port, bool privport, bool oobinline,
                bool nodelay, bool keepalive, Plug *plug)
 {
@@ -768,6 +1101,14 @@ Socket *sk_new(SockAddr *addr, int port, bool privport, bool oobinline,
     s->localhost_only = false;    /* unused, but best init anyway */
     s->pending_error = 0;
     s->parent = s->child = NULL;
+    s->racer = s->race_owner = NULL;
+    s->race_addrs_exhausted = false;
+    s->recv_size = NET_RECV_MIN;
+    s->splice_peer = NULL;
+    s->splice_pipe[0] = s->splice_pipe[1] = -1;
+    s->splice_pending = 0;
+    s->splice_eof = false;
+    memset(&s->stats, 0, sizeof(s->stats));
     s->oobpending = false;
     s->outgoingeof = EOF_NO;
     s->incomingeof = false;
@@ -787,6 +1128,8 @@ Socket *sk_new(SockAddr *addr, int port, bool privport, bool oobinline,
 
     if (err)
         s->error = strerror(err);
+    else
+        net_race_schedule(s);
 
     return &s->sock;
 }
@@ -821,6 +1164,14 @@ Socket *sk_newlistener(const char *srcaddr, int port, Plug *plug,
     s->localhost_only = local_host_only;
     s->pending_error = 0;
     s->parent = s->child = NULL;
+    s->racer = s->race_owner = NULL;
+    s->race_addrs_exhausted = false;
+    s->recv_size = NET_RECV_MIN;
+    s->splice_peer = NULL;
+    s->splice_pipe[0] = s->splice_pipe[1] = -1;
+    s->splice_pending = 0;
+    s->splice_eof = false;
+    memset(&s->stats, 0, sizeof(s->stats));
     s->oobpending = false;
     s->outgoingeof = EOF_NO;
     s->incomingeof = false;
@@ -866,6 +1217,7 @@ Socket *sk_newlistener(const char *srcaddr, int port, Plug *plug,
     }
 
     cloexec(fd);
+    nonblock(fd);                      /* so we can accept in batches */
 
     s->oobinline = false;
 
@@ -1003,8 +1355,15 @@ static void sk_net_close(Socket *sock)
     if (s->child)
         sk_net_close(&s->child->sock);
 
+    net_race_stop(s);
+    net_splice_stop(s);
     bufchain_clear(&s->output_data);
 
+    net_stats.send_calls += s->stats.send_calls;
+    net_stats.recv_calls += s->stats.recv_calls;
+    net_stats.bytes_sent += s->stats.bytes_sent;
+    net_stats.bytes_received += s->stats.bytes_received;
+
     del234(sktree, s);
     if (s->s >= 0) {
         uxsel_del(s->s);
@@ -1105,23 +1464,36 @@ static void socket_error_callback(void *vs)
 void try_send(NetSocket *s)
 {
     while (s->sending_oob || bufchain_size(&s->output_data) > 0) {
-        int nsent;
+        ssize_t nsent;
         int err;
-        const void *data;
         size_t len;
-        int urgentflag;
 
         if (s->sending_oob) {
-            urgentflag = MSG_OOB;
             len = s->sending_oob;
-            data = &s->oobdata;
+            nsent = send(s->s, &s->oobdata, len, MSG_OOB);
         } else {
-            urgentflag = 0;
-            ptrlen bufdata = bufchain_prefix(&s->output_data);
-            data = bufdata.ptr;
-            len = bufdata.len;
+            /*
+             * Hand the kernel as much of the buffer chain as we can
+             * in one go, rather than a granule at a time.
+             */
+            ptrlen granules[NET_SEND_IOV];
+            struct iovec iov[NET_SEND_IOV];
+            struct msghdr msg;
+            size_t n = bufchain_prefixes(
+                &s->output_data, granules, NET_SEND_IOV);
+
+            len = 0;
+            for (size_t i = 0; i < n; i++) {
+                iov[i].iov_base = (void *)granules[i].ptr;
+                iov[i].iov_len = granules[i].len;
+                len += granules[i].len;
+            }
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = iov;
+            msg.msg_iovlen = n;
+            nsent = sendmsg(s->s, &msg, 0);
         }
-        nsent = send(s->s, data, len, urgentflag);
+        s->stats.send_calls++;
         noise_ultralight(NOISE_SOURCE_IOLEN, nsent);
         if (nsent <= 0) {
             err = (nsent < 0 ? errno : 0);
@@ -1156,6 +1528,7 @@ void try_send(NetSocket *s)
                 return;
             }
         } else {
+            s->stats.bytes_sent += nsent;
             if (s->sending_oob) {
                 if (nsent < len) {
                     memmove(s->oobdata, s->oobdata+nsent, len-nsent);
@@ -1165,6 +1538,17 @@ void try_send(NetSocket *s)
                 }
             } else {
                 bufchain_consume(&s->output_data, nsent);
+                if (nsent < len) {
+                    /*
+                     * A short write means the socket's send buffer
+                     * is full, so rather than spend another system
+                     * call finding that out, wait until it's
+                     * writable again.
+                     */
+                    s->writable = false;
+                    uxsel_tell(s);
+                    return;
+                }
             }
         }
     }
@@ -1264,10 +1648,173 @@ static void sk_net_write_eof(Socket *sock)
     uxsel_tell(s);
 }
 
+/*
+ * Kernel-side relaying between a pair of sockets, used when data
+ * passing between two local connections doesn't need to be looked at
+ * on its way through.
+ */
+#if HAVE_SPLICE
+
+/* Maximum amount we move with a single splice() */
+#define NET_SPLICE_MAX 1048576
+
+static void net_splice_eof_callback(void *vs)
+{
+    NetSocket *s = (NetSocket *)vs;
+
+    if (!find234(sktree, s, NULL) || !s->splice_eof)
+        return;
+
+    s->splice_eof = false;
+    plug_closing_normal(s->plug);
+}
+
+/*
+ * Move as much data as we can out of src's pipe into its peer. We
+ * only do this once the peer's ordinary output buffer is empty, so
+ * that data written with sk_write before the splicing started still
+ * goes out first.
+ */
+static void net_splice_out(NetSocket *src)
+{
+    NetSocket *dst = src->splice_peer;
+
+    while (src->splice_pending && !bufchain_size(&dst->output_data) &&
+           !dst->pending_error) {
+        ssize_t ret = splice(src->splice_pipe[0], NULL, dst->s, NULL,
+                             src->splice_pending,
+                             SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        dst->stats.send_calls++;
+        if (ret < 0) {
+            if (errno == EAGAIN) {
+                dst->writable = false;
+            } else {
+                /* Report this via the callback, as try_send does */
+                dst->pending_error = errno;
+                queue_toplevel_callback(socket_error_callback, dst);
+            }
+            break;
+        }
+        src->splice_pending -= ret;
+        dst->stats.bytes_sent += ret;
+    }
+
+    uxsel_tell(src);
+    uxsel_tell(dst);
+
+    if (!src->splice_pending && src->splice_eof)
+        queue_toplevel_callback(net_splice_eof_callback, src);
+}
+
+static void net_splice_in(NetSocket *s)
+{
+    ssize_t ret = splice(s->s, NULL, s->splice_pipe[1], NULL,
+                         NET_SPLICE_MAX, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    s->stats.recv_calls++;
+    noise_ultralight(NOISE_SOURCE_IOLEN, ret);
+
+    if (ret < 0) {
+        if (errno != EAGAIN)
+            plug_closing_errno(s->plug, errno);
+    } else if (ret == 0) {
+        s->incomingeof = true;
+        uxsel_tell(s);
+        if (s->splice_pending)
+            s->splice_eof = true;      /* report it once the pipe drains */
+        else
+            plug_closing_normal(s->plug);
+    } else {
+        s->splice_pending += ret;
+        s->stats.bytes_received += ret;
+        net_splice_out(s);
+    }
+}
+
+static void net_splice_stop(NetSocket *s)
+{
+    NetSocket *peer = s->splice_peer;
+    if (!peer)
+        return;
+
+    /*
+     * Anything still in either pipe is discarded: the data bound for
+     * the socket being closed has nowhere to go, and the peer is
+     * normally being closed too.
+     */
+    s->splice_peer = peer->splice_peer = NULL;
+    for (size_t i = 0; i < 2; i++) {
+        close(s->splice_pipe[i]);
+        close(peer->splice_pipe[i]);
+        s->splice_pipe[i] = peer->splice_pipe[i] = -1;
+    }
+    s->splice_pending = peer->splice_pending = 0;
+
+    if (peer->splice_eof)
+        queue_toplevel_callback(net_splice_eof_callback, peer);
+    uxsel_tell(peer);
+}
+
+static bool net_splice_ok(NetSocket *s)
+{
+    return (s->connected && !s->listener && !s->splice_peer &&
+            !s->pending_error && !s->incomingeof &&
+            !s->oobinline && !s->sending_oob && !s->racer);
+}
+
+/*
+ * Start relaying everything that arrives on each of a pair of sockets
+ * to the other, in the kernel. The plugs stop seeing incoming data,
+ * but are still told about EOF and errors, and may still write to
+ * their sockets. Returns false if this isn't possible, in which case
+ * nothing has changed.
+ */
+bool sk_net_splice(Socket *sa, Socket *sb)
+{
+    if (sa->vt != &NetSocket_sockvt || sb->vt != &NetSocket_sockvt)
+        return false;
+    NetSocket *a = container_of(sa, NetSocket, sock);
+    NetSocket *b = container_of(sb, NetSocket, sock);
+    if (a == b || !net_splice_ok(a) || !net_splice_ok(b))
+        return false;
+
+    if (pipe(a->splice_pipe) < 0)
+        return false;
+    if (pipe(b->splice_pipe) < 0) {
+        close(a->splice_pipe[0]);
+        close(a->splice_pipe[1]);
+        a->splice_pipe[0] = a->splice_pipe[1] = -1;
+        return false;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        cloexec(a->splice_pipe[i]);
+        cloexec(b->splice_pipe[i]);
+    }
+#ifdef F_SETPIPE_SZ
+    /* A larger pipe means fewer round trips; failure is harmless */
+    fcntl(a->splice_pipe[1], F_SETPIPE_SZ, NET_RECV_MAX);
+    fcntl(b->splice_pipe[1], F_SETPIPE_SZ, NET_RECV_MAX);
+#endif
+
+    a->splice_peer = b;
+    b->splice_peer = a;
+    uxsel_tell(a);
+    uxsel_tell(b);
+    return true;
+}
+
+#else /* HAVE_SPLICE */
+
+static void net_splice_out(NetSocket *src) {}
+static void net_splice_in(NetSocket *s) {}
+static void net_splice_stop(NetSocket *s) {}
+bool sk_net_splice(Socket *sa, Socket *sb) { return false; }
+
+#endif /* HAVE_SPLICE */
+
 static void net_select_result(int fd, int event)
 {
     int ret;
-    char buf[20480];                   /* nice big buffer for plenty of speed */
+    char buf[NET_RECV_MIN];            /* see comment by net_recvbuf */
     NetSocket *s;
     bool atmark = true;
 
@@ -1320,27 +1867,37 @@ static void net_select_result(int fd, int event)
         if (s->listener) {
             /*
              * On a listening socket, the readability event means a
-             * connection is ready to be accepted.
+             * connection is ready to be accepted. Listening sockets
+             * are non-blocking, so when connections are arriving
+             * quickly, we take up to ACCEPT_BATCH of them at a time
+             * instead of going round the event loop for each one.
              */
-            union sockaddr_union su;
-            socklen_t addrlen = sizeof(su);
-            accept_ctx_t actx;
-            int t;  /* socket of connection */
-
-            memset(&su, 0, addrlen);
-            t = accept(s->s, &su.sa, &addrlen);
-            if (t < 0) {
-                break;
-            }
+            for (int i = 0; i < ACCEPT_BATCH; i++) {
+                union sockaddr_union su;
+                socklen_t addrlen = sizeof(su);
+                accept_ctx_t actx;
+                int t;  /* socket of connection */
+
+                memset(&su, 0, addrlen);
+                t = accept(s->s, &su.sa, &addrlen);
+                if (t < 0) {
+                    break;
+                }
+
+                nonblock(t);
+                actx.i = t;
 
-            nonblock(t);
-            actx.i = t;
+                if ((!s->addr || s->addr->superfamily != UNIX) &&
+                    s->localhost_only && !sockaddr_is_loopback(&su.sa)) {
+                    close(t);          /* someone let nonlocal through?! */
+                } else if (plug_accepting(s->plug, sk_net_accept, actx)) {
+                    close(t);          /* denied or error */
+                }
 
-            if ((!s->addr || s->addr->superfamily != UNIX) &&
-                s->localhost_only && !sockaddr_is_loopback(&su.sa)) {
-                close(t);              /* someone let nonlocal through?! */
-            } else if (plug_accepting(s->plug, sk_net_accept, actx)) {
-                close(t);              /* denied or error */
+                /* The plug might have closed the listener, so check
+                 * it's still there before trying again. */
+                if (find234(sktree, &fd, cmpforsearch) != s)
+                    break;
             }
             break;
         }
@@ -1354,6 +1911,11 @@ static void net_select_result(int fd, int event)
         if (s->frozen)
             break;
 
+        if (s->splice_peer) {
+            net_splice_in(s);
+            break;
+        }
+
         /*
          * We have received data on the socket. For an oobinline
          * socket, this might be data _before_ an urgent pointer,
@@ -1370,13 +1932,24 @@ static void net_select_result(int fd, int event)
         } else
             atmark = true;
 
-        ret = recv(s->s, buf, s->oobpending ? 1 : sizeof(buf), 0);
+        char *rbuf = buf;
+        size_t rsize = sizeof(buf);
+        if (!net_recvbuf_busy) {
+            sgrowarray(net_recvbuf, net_recvbuf_size, s->recv_size - 1);
+            rbuf = net_recvbuf;
+            rsize = s->recv_size;
+        }
+
+        ret = recv(s->s, rbuf, s->oobpending ? 1 : rsize, 0);
+        s->stats.recv_calls++;
         noise_ultralight(NOISE_SOURCE_IOLEN, ret);
         if (ret < 0) {
             if (errno == EWOULDBLOCK) {
                 break;
             }
         }
+        if (ret == rsize && s->recv_size < NET_RECV_MAX)
+            s->recv_size *= 2;
         if (ret < 0) {
             plug_closing_errno(s->plug, errno);
         } else if (0 == ret) {
@@ -1393,10 +1966,21 @@ static void net_select_result(int fd, int event)
                 sk_addr_free(s->addr);
                 s->addr = NULL;
             }
-            plug_receive(s->plug, atmark ? 0 : 1, buf, ret);
+            s->stats.bytes_received += ret;
+            if (rbuf == net_recvbuf) {
+                net_recvbuf_busy = true;
+                plug_receive(s->plug, atmark ? 0 : 1, rbuf, ret);
+                net_recvbuf_busy = false;
+            } else {
+                plug_receive(s->plug, atmark ? 0 : 1, rbuf, ret);
+            }
         }
         break;
       case SELECT_W:                   /* writable */
+        if (s->race_owner) {
+            net_race_select_result(s);
+            break;
+        }
         if (!s->connected) {
             /*
              * select/poll reports a socket as _writable_ when an
@@ -1427,16 +2011,32 @@ static void net_select_result(int fd, int event)
                     thisaddr = sk_extractaddr_tmp(s->addr, &s->step);
                     plug_log(s->plug, &s->sock, PLUGLOG_CONNECT_FAILED,
                              &thisaddr, s->port, errmsg, err);
+                    sfree(errmsg);
+
+                    if (s->racer) {
+                        /*
+                         * A racing attempt is already under way on
+                         * the next address, so carry on with that,
+                         * and start racing it in turn.
+                         */
+                        net_race_adopt(s);
+                        net_race_schedule(s);
+                        return;
+                    }
 
-                    while (err && s->addr && sk_nextaddr(s->addr, &s->step)) {
+                    while (err && s->addr && !s->race_addrs_exhausted &&
+                           sk_nextaddr(s->addr, &s->step)) {
                         err = try_connect(s);
                     }
                     if (err) {
+                        net_race_stop(s);
                         plug_closing_errno(s->plug, err);
                         return;      /* socket is now presumably defunct */
                     }
-                    if (!s->connected)
+                    if (!s->connected) {
+                        net_race_schedule(s);
                         return;      /* another async attempt in progress */
+                    }
                 } else {
                     /*
                      * The connection attempt succeeded.
@@ -1450,18 +2050,14 @@ static void net_select_result(int fd, int event)
             /*
              * If we get here, we've managed to make a connection.
              */
-            if (s->addr) {
-                sk_addr_free(s->addr);
-                s->addr = NULL;
-            }
-            s->connected = true;
-            s->writable = true;
-            uxsel_tell(s);
+            net_connect_done(s);
         } else {
             size_t bufsize_before, bufsize_after;
             s->writable = true;
             bufsize_before = s->sending_oob + bufchain_size(&s->output_data);
             try_send(s);
+            if (s->splice_peer)
+                net_splice_out(s->splice_peer);
             bufsize_after = s->sending_oob + bufchain_size(&s->output_data);
             if (bufsize_after < bufsize_before)
                 plug_sent(s->plug, bufsize_after);
@@ -1571,11 +2167,37 @@ int sk_net_get_fd(Socket *sock)
     return s->s;
 }
 
+void net_get_stats(NetSocketStats *stats)
+{
+    NetSocket *s;
+    int i;
+
+    *stats = net_stats;
+    for (i = 0; sktree && (s = index234(sktree, i)) != NULL; i++) {
+        stats->send_calls += s->stats.send_calls;
+        stats->recv_calls += s->stats.recv_calls;
+        stats->bytes_sent += s->stats.bytes_sent;
+        stats->bytes_received += s->stats.bytes_received;
+    }
+}
+
 static void uxsel_tell(NetSocket *s)
 {
     int rwx = 0;
     if (!s->pending_error) {
-        if (s->listener) {
+        if (s->splice_peer) {
+            /*
+             * Read only when the pipe to our peer is empty, and watch
+             * for writability when there's data waiting to come to us
+             * either from our own buffer or from our peer's pipe.
+             * Urgent data isn't supported in this mode.
+             */
+            if (!s->frozen && !s->incomingeof && !s->splice_pending)
+                rwx |= SELECT_R;
+            if (bufchain_size(&s->output_data) ||
+                s->splice_peer->splice_pending)
+                rwx |= SELECT_W;
+        } else if (s->listener) {
             rwx |= SELECT_R;           /* read == accept */
         } else {
             if (!s->connected)
@@ -1696,6 +2318,14 @@ Socket *new_unix_listener(SockAddr *listenaddr, Plug *plug)
     s->localhost_only = true;
     s->pending_error = 0;
     s->parent = s->child = NULL;
+    s->racer = s->race_owner = NULL;
+    s->race_addrs_exhausted = false;
+    s->recv_size = NET_RECV_MIN;
+    s->splice_peer = NULL;
+    s->splice_pipe[0] = s->splice_pipe[1] = -1;
+    s->splice_pending = 0;
+    s->splice_eof = false;
+    memset(&s->stats, 0, sizeof(s->stats));
     s->oobpending = false;
     s->outgoingeof = EOF_NO;
     s->incomingeof = false;
@@ -1715,6 +2345,7 @@ Socket *new_unix_listener(SockAddr *listenaddr, Plug *plug)
     }
 
     cloexec(fd);
+    nonblock(fd);                      /* so we can accept in batches */
 
     s->oobinline = false;
 
@@ -195,6 +195,7 @@ enum DialogSlot {
     DIALOG_SLOT_LOGFILE_PROMPT,
     DIALOG_SLOT_WARN_ON_CLOSE,
     DIALOG_SLOT_CONNECTION_FATAL,
+    DIALOG_SLOT_SAVE_SCROLLBACK,
     DIALOG_SLOT_LIMIT /* must remain last */
 };
 GtkWidget *gtk_seat_get_window(Seat *seat);
@@ -361,9 +362,21 @@ bool init_ucs(struct unicode_data *ucsdata, char *line_codepage,
  */
 void *sk_getxdmdata(Socket *sock, int *lenp);
 int sk_net_get_fd(Socket *sock);
+bool sk_net_splice(Socket *a, Socket *b);
 SockAddr *unix_sock_addr(const char *path);
 Socket *new_unix_listener(SockAddr *listenaddr, Plug *plug);
 
+/*
+ * Counts of send and receive system calls made by NetSockets, and
+ * the data they moved. net_get_stats returns the totals over every
+ * socket so far, open or closed.
+ */
+typedef struct NetSocketStats {
+    size_t send_calls, recv_calls;
+    uint64_t bytes_sent, bytes_received;
+} NetSocketStats;
+void net_get_stats(NetSocketStats *stats);
+
 /*
  * General helpful Unix stuff: more helpful version of the FD_SET
  * macro, which also handles maxfd.
@@ -443,6 +456,11 @@ static inline bool sk_peer_trusted(Socket *sock)
  */
 extern const SftpServerVtable unix_live_sftpserver_vt;
 
+/*
+ * server-workers.c.
+ */
+unsigned server_workers_start(unsigned nworkers, const char *appname);
+
 /*
  * utils/pollwrap.c.
  */
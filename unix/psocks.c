@@ -71,10 +71,20 @@ static PsocksDataSink *open_pipes(
     return &pdsp->pds;
 }
 
+/*
+ * Signals are passed to the main loop through this pipe, one byte per
+ * signal: 'c' for SIGCHLD, 's' for SIGUSR1 (which asks for a
+ * statistics report).
+ */
 static int signalpipe[2] = { -1, -1 };
 static void sigchld(int signum)
 {
-    if (write(signalpipe[1], "x", 1) <= 0)
+    if (write(signalpipe[1], "c", 1) <= 0)
+        /* not much we can do about it */;
+}
+static void sigusr1(int signum)
+{
+    if (write(signalpipe[1], "s", 1) <= 0)
         /* not much we can do about it */;
 }
 
@@ -93,13 +103,6 @@ static void start_subcommand(void)
 {
     pid_t pid;
 
-    /*
-     * Set up the pipe we'll use to tell us about SIGCHLD.
-     */
-    if (pipe(signalpipe) < 0) {
-        perror("pipe");
-        exit(1);
-    }
     putty_signal(SIGCHLD, sigchld);
 
     pid = fork();
@@ -119,6 +122,7 @@ static const PsocksPlatform platform = {
     open_pipes,
     found_subcommand,
     start_subcommand,
+    sk_net_splice,
 };
 
 static bool psocks_pw_setup(void *ctx, pollwrapper *pw)
@@ -130,9 +134,27 @@ static bool psocks_pw_setup(void *ctx, pollwrapper *pw)
 
 static void psocks_pw_check(void *ctx, pollwrapper *pw)
 {
+    psocks_state *ps = (psocks_state *)ctx;
+
     if (signalpipe[0] >= 0 &&
         pollwrap_check_fd_rwx(pw, signalpipe[0], SELECT_R)) {
-        while (true) {
+        char buf[64];
+        bool got_sigchld = false, got_sigusr1 = false;
+        ssize_t ret;
+
+        while ((ret = read(signalpipe[0], buf, sizeof(buf))) > 0) {
+            for (ssize_t i = 0; i < ret; i++) {
+                if (buf[i] == 's')
+                    got_sigusr1 = true;
+                else
+                    got_sigchld = true;
+            }
+        }
+
+        if (got_sigusr1)
+            psocks_dump_stats(ps);
+
+        while (got_sigchld) {
             int status;
             pid_t pid = waitpid(-1, &status, WNOHANG);
             if (pid <= 0)
@@ -155,10 +177,22 @@ int main(int argc, char **argv)
     CmdlineArgList *arglist = cmdline_arg_list_from_argv(argc, argv);
     psocks_cmdline(ps, arglist);
 
+    /*
+     * Set up the pipe we'll use to tell us about signals.
+     */
+    if (pipe(signalpipe) < 0) {
+        perror("pipe");
+        exit(1);
+    }
+    nonblock(signalpipe[0]);
+    cloexec(signalpipe[0]);
+    cloexec(signalpipe[1]);
+    putty_signal(SIGUSR1, sigusr1);
+
     sk_init();
     uxsel_init();
     psocks_start(ps);
     cmdline_arg_list_free(arglist);
 
-    cli_main_loop(psocks_pw_setup, psocks_pw_check, psocks_continue, NULL);
+    cli_main_loop(psocks_pw_setup, psocks_pw_check, psocks_continue, ps);
 }
@@ -161,6 +161,8 @@ static void show_help(FILE *fp)
     fputs("usage:   psusan [options]\n"
           "options: --listen SOCKETPATH  listen for connections on a Unix-domain socket\n"
           "         --listen-once        (with --listen) stop after one connection\n"
+          "         --workers N          (with --listen) share connections"
+          " among N processes\n"
           "         --verbose            print log messages to standard error\n"
           "         --sessiondir DIR     cwd for session subprocess (default $HOME)\n"
           "         --sshlog FILE        write ssh-connection packet log to FILE\n"
@@ -241,7 +243,7 @@ struct server_config {
     Conf *conf;
     const SshServerConfig *ssc;
 
-    unsigned next_id;
+    unsigned next_id, id_step;   /* ids are unique across all workers */
 
     Socket *listening_socket;
     Plug listening_plug;
@@ -254,7 +256,8 @@ static Plug *server_conn_plug(
 
     memset(inst, 0, sizeof(*inst));
 
-    inst->id = cfg->next_id++;
+    inst->id = cfg->next_id;
+    cfg->next_id += cfg->id_step;
     inst->logpolicy.vt = &server_logpolicy_vt;
 
     if (inst_out)
@@ -343,6 +346,7 @@ bool auth_successful(AuthPolicy *ap, ptrlen username, unsigned method)
 int main(int argc, char **argv)
 {
     const char *listen_socket = NULL;
+    unsigned nworkers = 0;
 
     SshServerConfig ssc;
 
@@ -387,12 +391,20 @@ int main(int argc, char **argv)
             listen_socket = val;
         } else if (!strcmp(arg, "--listen-once")) {
             listen_once = true;
+        } else if (longoptarg(arg, "--workers", &val, &argc, &argv)) {
+            nworkers = strtoul(val, NULL, 0);
         } else {
             fprintf(stderr, "%s: unrecognised option '%s'\n", appname, arg);
             exit(1);
         }
     }
 
+    if (nworkers > 1 && (!listen_socket || listen_once)) {
+        fprintf(stderr, "%s: --workers requires --listen, without "
+                "--listen-once\n", appname);
+        exit(1);
+    }
+
     sk_init();
     uxsel_init();
 
@@ -400,6 +412,7 @@ int main(int argc, char **argv)
     scfg.conf = conf;
     scfg.ssc = &ssc;
     scfg.next_id = 0;
+    scfg.id_step = 1;
 
     if (listen_socket) {
         listening = true;
@@ -416,6 +429,11 @@ int main(int argc, char **argv)
         log_to_stderr(inst->id, "running directly on stdio");
     }
 
+    if (nworkers > 1) {
+        scfg.next_id = server_workers_start(nworkers, appname);
+        scfg.id_step = nworkers;
+    }
+
     cli_main_loop(cliloop_no_pw_setup, cliloop_no_pw_check,
                   psusan_continue, NULL);
 
@@ -82,10 +82,24 @@ struct Pty {
     bufchain output_data;
     bool pending_eof;
     Backend backend;
+    char readbuf[65536];
 };
 
 #define PTY_MAX_BACKLOG 32768
 
+/*
+ * When output is available from the child, we keep reading until
+ * there's no more (or until we've collected enough), and pass it all
+ * on in one go. A program producing output fast would otherwise reach
+ * us in lots of small reads (often no more than a line at a time from
+ * a pty), each of which costs a full trip through the terminal
+ * emulator.
+ *
+ * We never let the amount waiting downstream plus the amount we've
+ * read exceed the size of readbuf, which is twice PTY_MAX_BACKLOG.
+ */
+#define PTY_READ_BATCH (2 * PTY_MAX_BACKLOG)
+
 /*
  * We store all the (active) PtyFd structures in a tree sorted by fd,
  * so that when we get an uxsel notification we know which backend
@@ -598,8 +612,7 @@ static void pty_uxsel_setup(Pty *pty);
 
 static void pty_real_select_result(Pty *pty, int fd, int event, int status)
 {
-    char buf[4096];
-    int ret;
+    ssize_t ret;
     bool finished = false;
 
     if (event < 0) {
@@ -633,19 +646,39 @@ static void pty_real_select_result(Pty *pty, int fd, int event, int status)
     } else {
         if (event == SELECT_R) {
             bool is_stdout = (fd == pty->master_o);
+            size_t got = 0, limit = PTY_MAX_BACKLOG;
+            int err = 0;
 
-            ret = read(fd, buf, sizeof(buf));
+            if (pty->output_backlog < PTY_MAX_BACKLOG)
+                limit = PTY_READ_BATCH - pty->output_backlog;
 
-            /*
-             * Treat EIO on a pty master as equivalent to EOF (because
-             * that's how the kernel seems to report the event where
-             * the last process connected to the other end of the pty
-             * went away).
-             */
-            if (fd == pty->master_fd && ret < 0 && errno == EIO)
-                ret = 0;
+            do {
+                ret = read(fd, pty->readbuf + got, limit - got);
+                err = errno;
 
-            if (ret == 0) {
+                /*
+                 * Treat EIO on a pty master as equivalent to EOF
+                 * (because that's how the kernel seems to report the
+                 * event where the last process connected to the other
+                 * end of the pty went away).
+                 */
+                if (fd == pty->master_fd && ret < 0 && err == EIO)
+                    ret = 0;
+
+                if (ret > 0)
+                    got += ret;
+            } while (ret > 0 && got < limit);
+
+            if (got > 0) {
+                pty->output_backlog = seat_output(
+                    pty->seat, !is_stdout, pty->readbuf, got);
+                pty_uxsel_setup(pty);
+            }
+
+            if (ret > 0 ||
+                (ret < 0 && (err == EAGAIN || err == EWOULDBLOCK))) {
+                /* Nothing more to read for now (or no room for it) */
+            } else if (ret == 0) {
                 /*
                  * EOF on this input fd, so to begin with, we may as
                  * well close it, and remove all references to it in
@@ -675,13 +708,10 @@ static void pty_real_select_result(Pty *pty, int fd, int event, int status)
                     if (!pty->child_dead)
                         pty->exit_code = 0;
                 }
-            } else if (ret < 0) {
+            } else {
+                errno = err;
                 perror("read pty master");
                 exit(1);
-            } else if (ret > 0) {
-                pty->output_backlog = seat_output(
-                    pty->seat, !is_stdout, buf, ret);
-                pty_uxsel_setup(pty);
             }
         } else if (event == SELECT_W) {
             /*
@@ -939,6 +969,10 @@ Backend *pty_backend_create(
         pty->fds[1].fd = pty->master_o = pty->pipefds[2];
         pty->fds[2].fd = pty->master_e = pty->pipefds[4];
 
+        /* So that we can read from them until they run dry */
+        nonblock(pty->master_o);
+        nonblock(pty->master_e);
+
         add234(ptyfds, &pty->fds[0]);
         add234(ptyfds, &pty->fds[1]);
         add234(ptyfds, &pty->fds[2]);
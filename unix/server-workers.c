@@ -0,0 +1,122 @@
+/*
+ * Pre-forked worker processes for the Unix SSH server tools (Uppity
+ * and psusan).
+ *
+ * Everything in PuTTY runs on a single-threaded event loop, and the
+ * timer list, the toplevel callback queue and the random number
+ * generator are all process-global. So instead of threads, a server
+ * that wants to use more than one CPU sets up its listening sockets
+ * and then splits into several worker processes. Each one inherits
+ * the listening sockets and runs its own event loop on them; the
+ * kernel hands each incoming connection to whichever worker accepts
+ * it first, and from then on that connection belongs to that worker
+ * alone.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "putty.h"
+
+static pid_t *worker_pids;
+static unsigned worker_count;
+
+static void workers_terminate(int signum)
+{
+    for (unsigned i = 0; i < worker_count; i++)
+        if (worker_pids[i] > 0)
+            kill(worker_pids[i], SIGTERM);
+    _exit(1);
+}
+
+/*
+ * Each worker starts with an identical copy of the parent's random
+ * number generator, so before it does anything else it must stir in
+ * something unique to itself.
+ */
+static void worker_reseed(unsigned index)
+{
+    strbuf *seed = strbuf_new_nm();
+    put_uint32(seed, getpid());
+    put_uint32(seed, index);
+    put_uint64(seed, time(NULL));
+    put_uint32(seed, GETTICKCOUNT());
+
+    int fd = open("/dev/urandom", O_RDONLY);
+    if (fd >= 0) {
+        char buf[32];
+        if (read(fd, buf, sizeof(buf)) == sizeof(buf))
+            put_data(seed, buf, sizeof(buf));
+        smemclr(buf, sizeof(buf));
+        close(fd);
+    }
+
+    random_reseed(ptrlen_from_strbuf(seed));
+    strbuf_free(seed);
+}
+
+/*
+ * Fork 'nworkers' copies of the current process. In each copy, this
+ * function returns the worker's index, from 0 to nworkers-1. The
+ * original process never returns: it waits for the workers, and
+ * exits when they all have. Killing it with SIGTERM or SIGINT kills
+ * the workers too.
+ */
+unsigned server_workers_start(unsigned nworkers, const char *appname)
+{
+    worker_pids = snewn(nworkers, pid_t);
+    worker_count = nworkers;
+
+    for (unsigned i = 0; i < nworkers; i++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            fprintf(stderr, "%s: fork: %s\n", appname, strerror(errno));
+            workers_terminate(0);
+        } else if (pid == 0) {
+            sfree(worker_pids);
+            worker_pids = NULL;
+            worker_count = 0;
+            if (random_active)
+                worker_reseed(i);
+            return i;
+        }
+        worker_pids[i] = pid;
+    }
+
+    putty_signal(SIGTERM, workers_terminate);
+    putty_signal(SIGINT, workers_terminate);
+
+    unsigned nrunning = nworkers;
+    while (nrunning > 0) {
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (unsigned i = 0; i < nworkers; i++) {
+            if (worker_pids[i] == pid) {
+                worker_pids[i] = 0;
+                nrunning--;
+                if (WIFSIGNALED(status))
+                    fprintf(stderr, "%s: worker %u killed by signal %d\n",
+                            appname, i, WTERMSIG(status));
+                else if (WIFEXITED(status) && WEXITSTATUS(status))
+                    fprintf(stderr, "%s: worker %u exited with status %d\n",
+                            appname, i, WEXITSTATUS(status));
+            }
+        }
+    }
+
+    exit(0);
+}
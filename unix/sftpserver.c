@@ -26,9 +26,22 @@
 
 typedef struct UnixSftpServer UnixSftpServer;
 
+/*
+ * When a client reads a file sequentially, it typically has many read
+ * requests in flight at once, but we handle them one at a time, so
+ * each one could wait for the disk in turn. Instead, we ask the
+ * kernel to start fetching this much of the file beyond the current
+ * read in the background, topping it up whenever less than half of it
+ * is left.
+ */
+#define USS_READAHEAD 4194304
+
 struct UnixSftpServer {
     unsigned *fdseqs;
     bool *fdsopen;
+    /* Read-ahead state: where the last read on each fd ended, and how
+     * far past that we've asked the kernel to prefetch */
+    uint64_t *fdreadpos, *fdprefetched;
     size_t fdsize;
 
     tree234 *dirhandles;
@@ -80,6 +93,9 @@ static void uss_free(SftpServer *srv)
         if (uss->fdsopen[i])
             close(i);
     sfree(uss->fdseqs);
+    sfree(uss->fdsopen);
+    sfree(uss->fdreadpos);
+    sfree(uss->fdprefetched);
 
     while ((udh = delpos234(uss->dirhandles, 0)) != NULL) {
         closedir(udh->dp);
@@ -121,6 +137,9 @@ static void uss_return_new_handle(
         size_t old_size = uss->fdsize;
         sgrowarray(uss->fdseqs, uss->fdsize, fd);
         uss->fdsopen = sresize(uss->fdsopen, uss->fdsize, bool);
+        uss->fdreadpos = sresize(uss->fdreadpos, uss->fdsize, uint64_t);
+        uss->fdprefetched = sresize(
+            uss->fdprefetched, uss->fdsize, uint64_t);
         while (old_size < uss->fdsize) {
             uss->fdseqs[old_size] = 0;
             uss->fdsopen[old_size] = false;
@@ -129,6 +148,7 @@ static void uss_return_new_handle(
     }
     assert(!uss->fdsopen[fd]);
     uss->fdsopen[fd] = true;
+    uss->fdreadpos[fd] = uss->fdprefetched[fd] = 0;
     if (++uss->fdseqs[fd] == USS_DIRHANDLE_SEQ)
         uss->fdseqs[fd] = 0;
     uss_return_handle_raw(uss, reply, fd, uss->fdseqs[fd]);
@@ -248,6 +268,10 @@ static void uss_open(SftpServer *srv, SftpReplyBuilder *reply,
     if (fd < 0) {
         uss_error(uss, reply);
     } else {
+#if HAVE_POSIX_FADVISE
+        if (flags & SSH_FXF_READ)
+            posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
         uss_return_new_handle(uss, reply, fd);
     }
 }
@@ -508,30 +532,45 @@ static void uss_read(SftpServer *srv, SftpReplyBuilder *reply,
     }
 
     char *p = buf;
+    uint64_t pos = offset;
+
+    /*
+     * Use pread, so that we don't need a separate lseek for every
+     * request. If the file is fundamentally not a seekable kind of
+     * thing, fall back to plain read.
+     */
+    bool seekable = true;
+    ssize_t status = 0;
+    while (length > 0) {
+        status = (seekable ? pread(fd, p, length, pos) :
+                  read(fd, p, length));
+        if (status < 0 && seekable && errno == ESPIPE) {
+            seekable = false;
+            continue;
+        }
+        if (status <= 0)
+            break;
+
+        unsigned bytes_read = status;
+        assert(bytes_read <= length);
+        length -= bytes_read;
+        p += bytes_read;
+        pos += bytes_read;
+    }
 
-    int status = lseek(fd, offset, SEEK_SET);
-    if (status >= 0 || errno == ESPIPE) {
-        bool seekable = (status >= 0);
-        while (length > 0) {
-            status = read(fd, p, length);
-            if (status <= 0)
-                break;
-
-            unsigned bytes_read = status;
-            assert(bytes_read <= length);
-            length -= bytes_read;
-            p += bytes_read;
-
-            if (!seekable) {
-                /*
-                 * If the seek failed because the file is fundamentally
-                 * not a seekable kind of thing, abandon this loop after
-                 * one attempt, i.e. we just read whatever we could get
-                 * and we don't mind returning a short buffer.
-                 */
-            }
+#if HAVE_POSIX_FADVISE
+    if (seekable && p > buf && offset == uss->fdreadpos[fd]) {
+        /* This read carried on from the last one, so prefetch */
+        if (uss->fdprefetched[fd] < pos + USS_READAHEAD / 2) {
+            uint64_t start = (uss->fdprefetched[fd] > pos ?
+                              uss->fdprefetched[fd] : pos);
+            posix_fadvise(fd, start, pos + USS_READAHEAD - start,
+                          POSIX_FADV_WILLNEED);
+            uss->fdprefetched[fd] = pos + USS_READAHEAD;
         }
     }
+#endif
+    uss->fdreadpos[fd] = pos;
 
     if (status < 0) {
         uss_error(uss, reply);
@@ -556,20 +595,25 @@ static void uss_write(SftpServer *srv, SftpReplyBuilder *reply,
     const char *p = data.ptr;
     unsigned length = data.len;
 
-    int status = lseek(fd, offset, SEEK_SET);
-    if (status >= 0 || errno == ESPIPE) {
-
-        while (length > 0) {
-            status = write(fd, p, length);
-            assert(status != 0);
-            if (status < 0)
-                break;
-
-            unsigned bytes_written = status;
-            assert(bytes_written <= length);
-            length -= bytes_written;
-            p += bytes_written;
+    /* As in uss_read, use pwrite where we can, and write where we can't */
+    bool seekable = true;
+    ssize_t status = 0;
+    while (length > 0) {
+        status = (seekable ? pwrite(fd, p, length, offset) :
+                  write(fd, p, length));
+        if (status < 0 && seekable && errno == ESPIPE) {
+            seekable = false;
+            continue;
         }
+        assert(status != 0);
+        if (status < 0)
+            break;
+
+        unsigned bytes_written = status;
+        assert(bytes_written <= length);
+        length -= bytes_written;
+        p += bytes_written;
+        offset += bytes_written;
     }
 
     if (status < 0) {
@@ -579,107 +623,181 @@ static void uss_write(SftpServer *srv, SftpReplyBuilder *reply,
     }
 }
 
+/*
+ * A single FXP_NAME reply to FXP_READDIR can carry as many entries as
+ * we like, and returning one at a time costs the client a round trip
+ * per file. So we keep adding entries to the reply until it's at
+ * least this big. A single entry can only be a few hundred bytes, so
+ * the packet stays well within the limits clients impose (1Mb for
+ * PuTTY, 256Kb for OpenSSH).
+ */
+#define USS_READDIR_BYTES 65536
+
+struct uss_readdir_entry {
+    char *name, *longname;
+    struct fxp_attrs attrs;
+};
+
+/*
+ * Looking up user and group names can be expensive (it may involve
+ * reading /etc/passwd, or worse, a network directory service), and
+ * all the files in one directory often have the same owner. So we
+ * remember the last answer for the duration of one FXP_READDIR.
+ */
+struct uss_idcache {
+    bool uid_valid, gid_valid;
+    uid_t uid;
+    gid_t gid;
+    char *user, *group;
+};
+
+static const char *uss_idcache_user(struct uss_idcache *ic, uid_t uid)
+{
+    if (!ic->uid_valid || ic->uid != uid) {
+        struct passwd *pwd = getpwuid(uid);
+        sfree(ic->user);
+        if (pwd)
+            ic->user = dupstr(pwd->pw_name);
+        else
+            ic->user = dupprintf("%u", (unsigned)uid);
+        ic->uid = uid;
+        ic->uid_valid = true;
+    }
+    return ic->user;
+}
+
+static const char *uss_idcache_group(struct uss_idcache *ic, gid_t gid)
+{
+    if (!ic->gid_valid || ic->gid != gid) {
+        struct group *grp = getgrgid(gid);
+        sfree(ic->group);
+        if (grp)
+            ic->group = dupstr(grp->gr_name);
+        else
+            ic->group = dupprintf("%u", (unsigned)gid);
+        ic->gid = gid;
+        ic->gid_valid = true;
+    }
+    return ic->group;
+}
+
+static char *uss_longname(const struct stat *st, const char *name,
+                          struct uss_idcache *ic)
+{
+    char perms[11];
+    struct tm tm;
+
+    strcpy(perms, "----------");
+    switch (st->st_mode & S_IFMT) {
+      case S_IFBLK: perms[0] = 'b'; break;
+      case S_IFCHR: perms[0] = 'c'; break;
+      case S_IFDIR: perms[0] = 'd'; break;
+      case S_IFIFO: perms[0] = 'p'; break;
+      case S_IFLNK: perms[0] = 'l'; break;
+      case S_IFSOCK: perms[0] = 's'; break;
+    }
+    if (st->st_mode & S_IRUSR)
+        perms[1] = 'r';
+    if (st->st_mode & S_IWUSR)
+        perms[2] = 'w';
+    if (st->st_mode & S_IXUSR)
+        perms[3] = (st->st_mode & S_ISUID ? 's' : 'x');
+    else
+        perms[3] = (st->st_mode & S_ISUID ? 'S' : '-');
+    if (st->st_mode & S_IRGRP)
+        perms[4] = 'r';
+    if (st->st_mode & S_IWGRP)
+        perms[5] = 'w';
+    if (st->st_mode & S_IXGRP)
+        perms[6] = (st->st_mode & S_ISGID ? 's' : 'x');
+    else
+        perms[6] = (st->st_mode & S_ISGID ? 'S' : '-');
+    if (st->st_mode & S_IROTH)
+        perms[7] = 'r';
+    if (st->st_mode & S_IWOTH)
+        perms[8] = 'w';
+    if (st->st_mode & S_IXOTH)
+        perms[9] = 'x';
+
+    tm = *localtime(&st->st_mtime);
+
+    return dupprintf(
+        "%s %3u %-8s %-8s %8"PRIuMAX" %.3s %2d %02d:%02d %s",
+        perms, (unsigned)st->st_nlink, uss_idcache_user(ic, st->st_uid),
+        uss_idcache_group(ic, st->st_gid), (uintmax_t)st->st_size,
+        (&"JanFebMarAprMayJunJulAugSepOctNovDec"[3*tm.tm_mon]),
+        tm.tm_mday, tm.tm_hour, tm.tm_min, name);
+}
+
 static void uss_readdir(SftpServer *srv, SftpReplyBuilder *reply,
                         ptrlen handle, int max_entries, bool omit_longname)
 {
     UnixSftpServer *uss = container_of(srv, UnixSftpServer, srv);
     struct dirent *de;
     struct uss_dirhandle *udh;
+    struct uss_readdir_entry *entries = NULL;
+    size_t nentries = 0, entriessize = 0, bytes = 0;
+    struct uss_idcache ic;
 
     if ((udh = uss_lookup_dirhandle(uss, reply, handle)) == NULL)
         return;
 
-    errno = 0;
-    de = readdir(udh->dp);
-    if (!de) {
-        if (errno == 0) {
-            fxp_reply_error(reply, SSH_FX_EOF, "End of directory");
-        } else {
-            uss_error(uss, reply);
+    memset(&ic, 0, sizeof(ic));
+
+    while (nentries < (size_t)max_entries && bytes < USS_READDIR_BYTES) {
+        errno = 0;
+        de = readdir(udh->dp);
+        if (!de) {
+            /*
+             * If we've already collected some entries, return them,
+             * and leave the EOF or error to be reported in response
+             * to the next request.
+             */
+            if (nentries > 0)
+                break;
+            if (errno == 0) {
+                fxp_reply_error(reply, SSH_FX_EOF, "End of directory");
+            } else {
+                uss_error(uss, reply);
+            }
+            goto out;
         }
-    } else {
-        ptrlen longname = PTRLEN_LITERAL("");
-        char *longnamebuf = NULL;
-        struct fxp_attrs attrs = no_attrs;
+
+        sgrowarray(entries, entriessize, nentries);
+        struct uss_readdir_entry *ent = &entries[nentries++];
+        ent->name = dupstr(de->d_name);
+        ent->longname = NULL;
+        ent->attrs = no_attrs;
 
 #if HAVE_FSTATAT && HAVE_DIRFD
         struct stat st;
         if (!fstatat(dirfd(udh->dp), de->d_name, &st, AT_SYMLINK_NOFOLLOW)) {
-            char perms[11], *uidbuf = NULL, *gidbuf = NULL;
-            struct passwd *pwd;
-            struct group *grp;
-            const char *user, *group;
-            struct tm tm;
-
-            attrs = uss_translate_struct_stat(&st);
-
-            if (!omit_longname) {
-
-                strcpy(perms, "----------");
-                switch (st.st_mode & S_IFMT) {
-                  case S_IFBLK: perms[0] = 'b'; break;
-                  case S_IFCHR: perms[0] = 'c'; break;
-                  case S_IFDIR: perms[0] = 'd'; break;
-                  case S_IFIFO: perms[0] = 'p'; break;
-                  case S_IFLNK: perms[0] = 'l'; break;
-                  case S_IFSOCK: perms[0] = 's'; break;
-                }
-                if (st.st_mode & S_IRUSR)
-                    perms[1] = 'r';
-                if (st.st_mode & S_IWUSR)
-                    perms[2] = 'w';
-                if (st.st_mode & S_IXUSR)
-                    perms[3] = (st.st_mode & S_ISUID ? 's' : 'x');
-                else
-                    perms[3] = (st.st_mode & S_ISUID ? 'S' : '-');
-                if (st.st_mode & S_IRGRP)
-                    perms[4] = 'r';
-                if (st.st_mode & S_IWGRP)
-                    perms[5] = 'w';
-                if (st.st_mode & S_IXGRP)
-                    perms[6] = (st.st_mode & S_ISGID ? 's' : 'x');
-                else
-                    perms[6] = (st.st_mode & S_ISGID ? 'S' : '-');
-                if (st.st_mode & S_IROTH)
-                    perms[7] = 'r';
-                if (st.st_mode & S_IWOTH)
-                    perms[8] = 'w';
-                if (st.st_mode & S_IXOTH)
-                    perms[9] = 'x';
-
-                if ((pwd = getpwuid(st.st_uid)) != NULL)
-                    user = pwd->pw_name;
-                else
-                    user = uidbuf = dupprintf("%u", (unsigned)st.st_uid);
-                if ((grp = getgrgid(st.st_gid)) != NULL)
-                    group = grp->gr_name;
-                else
-                    group = gidbuf = dupprintf("%u", (unsigned)st.st_gid);
-
-                tm = *localtime(&st.st_mtime);
-
-                longnamebuf = dupprintf(
-                    "%s %3u %-8s %-8s %8"PRIuMAX" %.3s %2d %02d:%02d %s",
-                    perms, (unsigned)st.st_nlink, user, group,
-                    (uintmax_t)st.st_size,
-                    (&"JanFebMarAprMayJunJulAugSepOctNovDec"[3*tm.tm_mon]),
-                    tm.tm_mday, tm.tm_hour, tm.tm_min, de->d_name);
-                longname = ptrlen_from_asciz(longnamebuf);
-
-                sfree(uidbuf);
-                sfree(gidbuf);
-            }
+            ent->attrs = uss_translate_struct_stat(&st);
+            if (!omit_longname)
+                ent->longname = uss_longname(&st, ent->name, &ic);
         }
 #endif
 
-        /* FIXME: be able to return more than one, in which case we
-         * must also check max_entries */
-        fxp_reply_name_count(reply, 1);
-        fxp_reply_full_name(reply, ptrlen_from_asciz(de->d_name),
-                            longname, attrs);
+        /* Name, longname and a generous allowance for the attributes */
+        bytes += 8 + strlen(ent->name) +
+            (ent->longname ? strlen(ent->longname) : 0) + 32;
+    }
 
-        sfree(longnamebuf);
+    fxp_reply_name_count(reply, nentries);
+    for (size_t i = 0; i < nentries; i++)
+        fxp_reply_full_name(
+            reply, ptrlen_from_asciz(entries[i].name),
+            (entries[i].longname ? ptrlen_from_asciz(entries[i].longname) :
+             PTRLEN_LITERAL("")), entries[i].attrs);
+
+  out:
+    for (size_t i = 0; i < nentries; i++) {
+        sfree(entries[i].name);
+        sfree(entries[i].longname);
     }
+    sfree(entries);
+    sfree(ic.user);
+    sfree(ic.group);
 }
 
 const SftpServerVtable unix_live_sftpserver_vt = {
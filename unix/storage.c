@@ -370,13 +370,13 @@ static const char *get_setting(const char *key)
 
 struct settings_r {
     tree234 *t;
+    char *data;            /* the whole file; keys and values point in here */
 };
 
 settings_r *open_settings_r(const char *sessionname)
 {
     char *filename;
     FILE *fp;
-    char *line;
     settings_r *toret;
 
     filename = make_filename(INDEX_SESSION, sessionname);
@@ -385,30 +385,39 @@ settings_r *open_settings_r(const char *sessionname)
     if (!fp)
         return NULL;                   /* can't open */
 
+    /*
+     * Read the file in one go, and split it into lines and key=value
+     * pairs in place, so that the tree entries can point into the
+     * buffer instead of each needing two allocations of their own.
+     */
+    strbuf *sb = strbuf_new();
+    read_file_into(BinarySink_UPCAST(sb), fp);
+    fclose(fp);
+
     toret = snew(settings_r);
     toret->t = newtree234(keycmp);
+    toret->data = strbuf_to_str(sb);
 
-    while ( (line = fgetline(fp)) ) {
-        char *value = strchr(line, '=');
-        struct skeyval *kv;
+    char *line = toret->data, *next;
+    for (; *line; line = next) {
+        size_t linelen = strcspn(line, "\n");
+        next = line + linelen;
+        if (*next)
+            *next++ = '\0';
 
-        if (!value) {
-            sfree(line);
+        char *value = strchr(line, '=');
+        if (!value)
             continue;
-        }
         *value++ = '\0';
-        value[strcspn(value, "\r\n")] = '\0';   /* trim trailing NL */
-
-        kv = snew(struct skeyval);
-        kv->key = dupstr(line);
-        kv->value = dupstr(value);
-        add234(toret->t, kv);
+        value[strcspn(value, "\r")] = '\0';  /* trim trailing CR */
 
-        sfree(line);
+        struct skeyval *kv = snew(struct skeyval);
+        kv->key = line;
+        kv->value = value;
+        if (add234(toret->t, kv) != kv)
+            sfree(kv);                 /* duplicate key: first one wins */
     }
 
-    fclose(fp);
-
     return toret;
 }
 
@@ -523,14 +532,11 @@ void close_settings_r(settings_r *handle)
     if (!handle)
         return;
 
-    while ( (kv = index234(handle->t, 0)) != NULL) {
-        del234(handle->t, kv);
-        sfree((char *)kv->key);
-        sfree((char *)kv->value);
+    while ( (kv = delpos234(handle->t, 0)) != NULL)
         sfree(kv);
-    }
 
     freetree234(handle->t);
+    sfree(handle->data);
     sfree(handle);
 }
 
@@ -542,94 +548,108 @@ void del_settings(const char *sessionname)
     sfree(filename);
 }
 
-struct settings_e {
+/*
+ * Enumerating a directory of saved sessions or host CAs. The
+ * directory's pathname is worked out once at the start, not once per
+ * entry (make_filename can involve getpwuid and several access()
+ * calls), and where readdir tells us the file type we don't stat each
+ * entry at all.
+ */
+struct enum_dir {
     DIR *dp;
+    strbuf *path;                      /* directory pathname plus '/' */
+    size_t baselen;
 };
 
-settings_e *enum_settings_start(void)
+static void enum_dir_start(struct enum_dir *ed, int index)
 {
-    DIR *dp;
-    char *filename;
-
-    filename = make_filename(INDEX_SESSIONDIR, NULL);
-    dp = opendir(filename);
-    sfree(filename);
-
-    settings_e *toret = snew(settings_e);
-    toret->dp = dp;
-    return toret;
+    char *dirname = make_filename(index, NULL);
+    ed->dp = opendir(dirname);
+    ed->path = strbuf_new();
+    put_dataz(ed->path, dirname);
+    put_byte(ed->path, '/');
+    ed->baselen = ed->path->len;
+    sfree(dirname);
 }
 
-static bool enum_dir_next(DIR *dp, int index, strbuf *out)
+static bool enum_dir_next(struct enum_dir *ed, strbuf *out)
 {
     struct dirent *de;
     struct stat st;
-    strbuf *fullpath;
 
-    if (!dp)
+    if (!ed->dp)
         return false;
 
-    fullpath = strbuf_new();
-
-    char *sessiondir = make_filename(index, NULL);
-    put_dataz(fullpath, sessiondir);
-    sfree(sessiondir);
-    put_byte(fullpath, '/');
-
-    size_t baselen = fullpath->len;
-
-    while ( (de = readdir(dp)) != NULL ) {
-        strbuf_shrink_to(fullpath, baselen);
-        put_dataz(fullpath, de->d_name);
+    while ( (de = readdir(ed->dp)) != NULL ) {
+#if HAVE_DIRENT_D_TYPE
+        if (de->d_type != DT_UNKNOWN && de->d_type != DT_LNK) {
+            if (de->d_type != DT_REG)
+                continue;              /* try another one */
+        } else
+#endif
+        {
+            strbuf_shrink_to(ed->path, ed->baselen);
+            put_dataz(ed->path, de->d_name);
 
-        if (stat(fullpath->s, &st) < 0 || !S_ISREG(st.st_mode))
-            continue;                  /* try another one */
+            if (stat(ed->path->s, &st) < 0 || !S_ISREG(st.st_mode))
+                continue;              /* try another one */
+        }
 
         decode_session_filename(de->d_name, out);
-        strbuf_free(fullpath);
         return true;
     }
 
-    strbuf_free(fullpath);
     return false;
 }
 
+static void enum_dir_finish(struct enum_dir *ed)
+{
+    if (ed->dp)
+        closedir(ed->dp);
+    strbuf_free(ed->path);
+}
+
+struct settings_e {
+    struct enum_dir ed;
+};
+
+settings_e *enum_settings_start(void)
+{
+    settings_e *toret = snew(settings_e);
+    enum_dir_start(&toret->ed, INDEX_SESSIONDIR);
+    return toret;
+}
+
 bool enum_settings_next(settings_e *handle, strbuf *out)
 {
-    return enum_dir_next(handle->dp, INDEX_SESSIONDIR, out);
+    return enum_dir_next(&handle->ed, out);
 }
 
 void enum_settings_finish(settings_e *handle)
 {
-    if (handle->dp)
-        closedir(handle->dp);
+    enum_dir_finish(&handle->ed);
     sfree(handle);
 }
 
 struct host_ca_enum {
-    DIR *dp;
+    struct enum_dir ed;
 };
 
 host_ca_enum *enum_host_ca_start(void)
 {
     host_ca_enum *handle = snew(host_ca_enum);
-
-    char *filename = make_filename(INDEX_HOSTCADIR, NULL);
-    handle->dp = opendir(filename);
-    sfree(filename);
-
+    enum_dir_start(&handle->ed, INDEX_HOSTCADIR);
     return handle;
 }
 
 bool enum_host_ca_next(host_ca_enum *handle, strbuf *out)
 {
-    return enum_dir_next(handle->dp, INDEX_HOSTCADIR, out);
+    return enum_dir_next(&handle->ed, out);
 }
 
 void enum_host_ca_finish(host_ca_enum *handle)
 {
-    if (handle->dp)
-        closedir(handle->dp);
+    enum_dir_finish(&handle->ed);
     sfree(handle);
 }
 
@@ -746,74 +766,136 @@ char *host_ca_delete(const char *name)
  * e.g.
  *
  *   rsa@22:foovax.example.org 0x23,0x293487364395345345....2343
+ *
+ * A single connection can look up several host keys (one for each
+ * key type we might negotiate), and the file can be large, so rather
+ * than scanning it on each lookup, we read it once into a tree234
+ * indexed by the 'type@port:hostname' part. The index is reloaded if
+ * the file's inode, size or modification time changes, which covers
+ * both ways we update it: appending, and replacing it via rename.
  */
-int check_stored_host_key(const char *hostname, int port,
-                          const char *keytype, const char *key)
+typedef struct hostkey_entry {
+    char *line;                        /* the whole line, newline removed */
+    ptrlen header;                     /* type@port:hostname */
+    const char *key;                   /* keydata, following the space */
+} hostkey_entry;
+
+static struct {
+    tree234 *index;
+    bool loaded;
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    time_t mtime;
+} hostkeys;
+
+static int hostkey_cmp(void *av, void *bv)
 {
-    FILE *fp;
-    char *filename;
-    char *line;
-    int ret;
+    hostkey_entry *a = (hostkey_entry *)av, *b = (hostkey_entry *)bv;
+    return ptrlen_strcmp(a->header, b->header);
+}
 
-    filename = make_filename(INDEX_HOSTKEYS, NULL);
-    fp = fopen(filename, "r");
+static void hostkeys_discard(void)
+{
+    if (hostkeys.index) {
+        hostkey_entry *e;
+        while ((e = delpos234(hostkeys.index, 0)) != NULL) {
+            sfree(e->line);
+            sfree(e);
+        }
+        freetree234(hostkeys.index);
+        hostkeys.index = NULL;
+    }
+    hostkeys.loaded = false;
+}
+
+/*
+ * Make sure hostkeys.index reflects the current contents of the host
+ * keys file. Returns false if the file doesn't exist (or can't be
+ * read), in which case the index is empty.
+ */
+static bool hostkeys_load(void)
+{
+    char *filename = make_filename(INDEX_HOSTKEYS, NULL);
+    FILE *fp = fopen(filename, "r");
     sfree(filename);
-    if (!fp)
-        return 1;                      /* key does not exist */
 
-    ret = 1;
-    while ( (line = fgetline(fp)) ) {
-        int i;
-        char *p = line;
-        char porttext[20];
+    struct stat st;
+    if (!fp || fstat(fileno(fp), &st) < 0) {
+        if (fp)
+            fclose(fp);
+        hostkeys_discard();
+        return false;
+    }
 
-        line[strcspn(line, "\n")] = '\0';   /* strip trailing newline */
+    if (hostkeys.loaded && hostkeys.dev == st.st_dev &&
+        hostkeys.ino == st.st_ino && hostkeys.size == st.st_size &&
+        hostkeys.mtime == st.st_mtime) {
+        fclose(fp);
+        return true;                   /* index is still up to date */
+    }
 
-        i = strlen(keytype);
-        if (strncmp(p, keytype, i))
-            goto done;
-        p += i;
+    hostkeys_discard();
+    hostkeys.index = newtree234(hostkey_cmp);
 
-        if (*p != '@')
-            goto done;
-        p++;
+    char *line;
+    while ( (line = fgetline(fp)) ) {
+        line[strcspn(line, "\n")] = '\0';   /* strip trailing newline */
 
-        sprintf(porttext, "%d", port);
-        i = strlen(porttext);
-        if (strncmp(p, porttext, i))
-            goto done;
-        p += i;
+        const char *space = strchr(line, ' ');
+        if (!space) {
+            sfree(line);
+            continue;
+        }
 
-        if (*p != ':')
-            goto done;
-        p++;
+        hostkey_entry *e = snew(hostkey_entry);
+        e->line = line;
+        e->header = make_ptrlen(line, space - line);
+        e->key = space + 1;
+        if (add234(hostkeys.index, e) != e) {
+            /* Duplicate entry: as before, the first one in the file wins */
+            sfree(e->line);
+            sfree(e);
+        }
+    }
 
-        i = strlen(hostname);
-        if (strncmp(p, hostname, i))
-            goto done;
-        p += i;
+    fclose(fp);
+    hostkeys.loaded = true;
+    hostkeys.dev = st.st_dev;
+    hostkeys.ino = st.st_ino;
+    hostkeys.size = st.st_size;
+    hostkeys.mtime = st.st_mtime;
+    return true;
+}
 
-        if (*p != ' ')
-            goto done;
-        p++;
+static hostkey_entry *hostkeys_find(ptrlen header)
+{
+    if (!hostkeys_load())
+        return NULL;
 
-        /*
-         * Found the key. Now just work out whether it's the right
-         * one or not.
-         */
-        if (!strcmp(p, key))
-            ret = 0;                   /* key matched OK */
-        else
-            ret = 2;                   /* key mismatch */
+    hostkey_entry search;
+    search.header = header;
+    return find234(hostkeys.index, &search, NULL);
+}
 
-      done:
-        sfree(line);
-        if (ret != 1)
-            break;
-    }
+int check_stored_host_key(const char *hostname, int port,
+                          const char *keytype, const char *key)
+{
+    char *header = dupprintf("%s@%d:%s", keytype, port, hostname);
+    hostkey_entry *e = hostkeys_find(ptrlen_from_asciz(header));
+    sfree(header);
 
-    fclose(fp);
-    return ret;
+    if (!e)
+        return 1;                      /* key does not exist */
+
+    /*
+     * Found the key. Now just work out whether it's the right one or
+     * not.
+     */
+    if (!strcmp(e->key, key))
+        return 0;                      /* key matched OK */
+    else
+        return 2;                      /* key mismatch */
 }
 
 bool have_ssh_host_key(const char *hostname, int port,
@@ -826,20 +908,15 @@ bool have_ssh_host_key(const char *hostname, int port,
     return check_stored_host_key(hostname, port, keytype, "") != 1;
 }
 
-void store_host_key(Seat *seat, const char *hostname, int port,
-                    const char *keytype, const char *key)
+/*
+ * Open one of the host key files for writing, creating the directory
+ * it lives in if necessary. Reports errors to the seat.
+ */
+static FILE *open_hostkeys_for_write(Seat *seat, const char *filename,
+                                     const char *mode)
 {
-    FILE *rfp, *wfp;
-    char *newtext, *line;
-    int headerlen;
-    char *filename, *tmpfilename;
-
-    /*
-     * Open both the old file and a new file.
-     */
-    tmpfilename = make_filename(INDEX_HOSTKEYS_TMP, NULL);
-    wfp = fopen(tmpfilename, "w");
-    if (!wfp && errno == ENOENT) {
+    FILE *fp = fopen(filename, mode);
+    if (!fp && errno == ENOENT) {
         char *dir, *errmsg;
 
         dir = make_filename(INDEX_DIR, NULL);
@@ -847,24 +924,62 @@ void store_host_key(Seat *seat, const char *hostname, int port,
             seat_nonfatal(seat, "Unable to store host key: %s", errmsg);
             sfree(errmsg);
             sfree(dir);
-            sfree(tmpfilename);
-            return;
+            return NULL;
         }
         sfree(dir);
 
-        wfp = fopen(tmpfilename, "w");
+        fp = fopen(filename, mode);
     }
-    if (!wfp) {
+    if (!fp) {
         seat_nonfatal(seat, "Unable to store host key: open(\"%s\") "
-                      "returned '%s'", tmpfilename, strerror(errno));
-        sfree(tmpfilename);
-        return;
+                      "returned '%s'", filename, strerror(errno));
     }
-    filename = make_filename(INDEX_HOSTKEYS, NULL);
-    rfp = fopen(filename, "r");
+    return fp;
+}
+
+void store_host_key(Seat *seat, const char *hostname, int port,
+                    const char *keytype, const char *key)
+{
+    FILE *rfp, *wfp;
+    char *newtext, *line;
+    int headerlen;
+    char *filename, *tmpfilename;
 
     newtext = dupprintf("%s@%d:%s %s\n", keytype, port, hostname, key);
     headerlen = 1 + strcspn(newtext, " ");   /* count the space too */
+    filename = make_filename(INDEX_HOSTKEYS, NULL);
+
+    /*
+     * If there's no existing entry for this host, we need only add
+     * one to the end of the file.
+     */
+    if (!hostkeys_find(make_ptrlen(newtext, headerlen - 1))) {
+        wfp = open_hostkeys_for_write(seat, filename, "a");
+        if (wfp) {
+            fputs(newtext, wfp);
+            if (fclose(wfp) < 0)
+                seat_nonfatal(seat, "Unable to store host key: write to "
+                              "\"%s\" returned '%s'", filename,
+                              strerror(errno));
+        }
+        sfree(filename);
+        sfree(newtext);
+        return;
+    }
+
+    /*
+     * Otherwise, we're replacing an existing key, so open both the
+     * old file and a new one.
+     */
+    tmpfilename = make_filename(INDEX_HOSTKEYS_TMP, NULL);
+    wfp = open_hostkeys_for_write(seat, tmpfilename, "w");
+    if (!wfp) {
+        sfree(tmpfilename);
+        sfree(filename);
+        sfree(newtext);
+        return;
+    }
+    rfp = fopen(filename, "r");
 
     /*
      * Copy all lines from the old file to the new one that _don't_
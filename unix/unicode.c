@@ -38,6 +38,36 @@ bool BinarySink_put_mb_to_wc(
             mbstr += i;
             mblen -= i;
         }
+    } else if (codepage == CS_UTF8) {
+        /*
+         * Decode runs of well-formed UTF-8 in bulk. Anything else is
+         * fed to the charset library's decoder a byte at a time,
+         * until it's back in its initial state, so that malformed
+         * input comes out exactly as it would have done if the
+         * charset library had decoded the whole string.
+         */
+        charset_state state = { 0 };
+        size_t len = mblen;
+
+        while (len > 0) {
+            unsigned cps[1024];
+            wchar_t wbuf[1024];
+            size_t n = decode_utf8_run(&mbstr, &len, cps, lenof(cps));
+            for (size_t i = 0; i < n; i++)
+                wbuf[i] = cps[i];
+            put_data(bs, wbuf, n * sizeof(wchar_t));
+
+            while (len > 0 && n < lenof(cps)) {
+                int inlen = 1;
+                int wlen = charset_to_unicode(&mbstr, &inlen, wbuf,
+                                              lenof(wbuf), CS_UTF8,
+                                              &state, NULL, 0);
+                put_data(bs, wbuf, wlen * sizeof(wchar_t));
+                len--;
+                if (state.s0 == 0)
+                    break;
+            }
+        }
     } else if (codepage == CS_NONE) {
         while (mblen > 0) {
             wchar_t wc = 0xD800 | (mbstr[0] & 0xFF);
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include <gtk/gtk.h>
 #if !GTK_CHECK_VERSION(3,0,0)
@@ -1344,14 +1345,23 @@ struct pangofont {
     /*
      * Cache of character widths, indexed by Unicode code point. In
      * pixels; -1 means we haven't asked Pango about this character
-     * before.
+     * before. It's stored sparsely, as pages of PANGO_WIDTH_PAGE
+     * entries allocated only when we first ask about a character in
+     * them, because a terminal uses only a few small regions of the
+     * Unicode space, some of them (e.g. emoji) a long way up it.
      */
-    int *widthcache;
-    unsigned nwidthcache;
+    int **widthcache;
+    unsigned nwidthpages;
 
     struct unifont u;
 };
 
+#define PANGO_WIDTH_PAGE 256
+
+#ifdef DRAW_TEXT_CAIRO
+static void pango_glyph_cache_purge(struct pangofont *pfont);
+#endif
+
 static const UnifontVtable pangofont_vtable = {
     .create = pangofont_create,
     .create_fallback = pangofont_create_fallback,
@@ -1482,7 +1492,7 @@ static unifont *pangofont_create_internal(GtkWidget *widget,
     pfont->shadowoffset = shadowoffset;
     pfont->shadowalways = shadowalways;
     pfont->widthcache = NULL;
-    pfont->nwidthcache = 0;
+    pfont->nwidthpages = 0;
 
     pango_font_metrics_unref(metrics);
 
@@ -1535,7 +1545,12 @@ static unifont *pangofont_create_fallback(GtkWidget *widget, int height,
 static void pangofont_destroy(unifont *font)
 {
     struct pangofont *pfont = container_of(font, struct pangofont, u);
+#ifdef DRAW_TEXT_CAIRO
+    pango_glyph_cache_purge(pfont);
+#endif
     pango_font_description_free(pfont->desc);
+    for (unsigned i = 0; i < pfont->nwidthpages; i++)
+        sfree(pfont->widthcache[i]);
     sfree(pfont->widthcache);
     g_object_unref(pfont->fset);
     sfree(pfont);
@@ -1553,21 +1568,29 @@ static int pangofont_char_width(PangoLayout *layout, struct pangofont *pfont,
      * the results.
      */
 
-    if ((unsigned)uchr >= pfont->nwidthcache) {
-        unsigned newsize = ((int)uchr + 0x100) & ~0xFF;
-        pfont->widthcache = sresize(pfont->widthcache, newsize, int);
-        while (pfont->nwidthcache < newsize)
-            pfont->widthcache[pfont->nwidthcache++] = -1;
+    unsigned page = (unsigned)uchr / PANGO_WIDTH_PAGE;
+    unsigned index = (unsigned)uchr % PANGO_WIDTH_PAGE;
+
+    if (page >= pfont->nwidthpages) {
+        pfont->widthcache = sresize(pfont->widthcache, page + 1, int *);
+        while (pfont->nwidthpages <= page)
+            pfont->widthcache[pfont->nwidthpages++] = NULL;
+    }
+
+    if (!pfont->widthcache[page]) {
+        pfont->widthcache[page] = snewn(PANGO_WIDTH_PAGE, int);
+        for (unsigned i = 0; i < PANGO_WIDTH_PAGE; i++)
+            pfont->widthcache[page][i] = -1;
     }
 
-    if (pfont->widthcache[uchr] < 0) {
+    if (pfont->widthcache[page][index] < 0) {
         PangoRectangle rect;
         pango_layout_set_text(layout, utfchr, utflen);
         pango_layout_get_extents(layout, NULL, &rect);
-        pfont->widthcache[uchr] = rect.width;
+        pfont->widthcache[page][index] = rect.width;
     }
 
-    return pfont->widthcache[uchr];
+    return pfont->widthcache[page][index];
 }
 
 static bool pangofont_has_glyph(unifont *font, wchar_t glyph)
@@ -1591,6 +1614,260 @@ static void pango_cairo_draw_layout(unifont_drawctx *ctx,
     cairo_move_to(ctx->u.cairo.cr, x, y);
     pango_cairo_show_layout(ctx->u.cairo.cr, layout);
 }
+
+/*
+ * Cache of rendered glyphs for Pango fonts in Cairo mode, shared
+ * between all fonts.
+ *
+ * Laying out and rendering text through Pango is much the most
+ * expensive part of repainting a terminal window, and a terminal
+ * draws the same few hundred characters over and over again. So the
+ * first time we draw each character (or combining cluster) in a given
+ * font, cell width and scale, we render it once into an image surface
+ * of its own, and on later occasions just paint that surface into
+ * place.
+ *
+ * Most glyphs are rendered in opaque black, so that the surface's
+ * alpha channel can be used as a mask for whatever colour the text is
+ * being drawn in. But if the rendering turns out to contain any
+ * colour of its own (e.g. an emoji from a colour font), we keep that
+ * and paint the surface directly.
+ *
+ * The cache holds at most PANGO_GLYPH_CACHE_BYTES of surface data,
+ * and when it's full, the least recently used glyph is thrown out.
+ */
+#define PANGO_GLYPH_CACHE_BYTES (16 << 20)
+
+typedef struct pango_cached_glyph pango_cached_glyph;
+struct pango_cached_glyph {
+    /* Lookup key */
+    struct pangofont *pfont;
+    bool bold;
+    int cellwidth;
+    double scale;
+    char *text;
+    size_t textlen;
+
+    /* The rendered glyph, and its offset in device pixels from the
+     * top left of the character cell(s) it's drawn in */
+    cairo_surface_t *surface;
+    int dx, dy;
+    bool colour;
+    size_t bytes;
+
+    /* Doubly linked list in order of use, most recent first */
+    pango_cached_glyph *lru_prev, *lru_next;
+};
+
+static tree234 *pango_glyph_cache;
+static pango_cached_glyph *pango_glyph_lru_head, *pango_glyph_lru_tail;
+static size_t pango_glyph_cache_bytes;
+
+static int pango_cached_glyph_cmp(void *av, void *bv)
+{
+    pango_cached_glyph *a = (pango_cached_glyph *)av;
+    pango_cached_glyph *b = (pango_cached_glyph *)bv;
+
+    if ((uintptr_t)a->pfont != (uintptr_t)b->pfont)
+        return (uintptr_t)a->pfont < (uintptr_t)b->pfont ? -1 : +1;
+    if (a->bold != b->bold)
+        return a->bold < b->bold ? -1 : +1;
+    if (a->cellwidth != b->cellwidth)
+        return a->cellwidth < b->cellwidth ? -1 : +1;
+    if (a->scale != b->scale)
+        return a->scale < b->scale ? -1 : +1;
+    if (a->textlen != b->textlen)
+        return a->textlen < b->textlen ? -1 : +1;
+    return memcmp(a->text, b->text, a->textlen);
+}
+
+static void pango_glyph_lru_unlink(pango_cached_glyph *g)
+{
+    if (g->lru_prev)
+        g->lru_prev->lru_next = g->lru_next;
+    else
+        pango_glyph_lru_head = g->lru_next;
+    if (g->lru_next)
+        g->lru_next->lru_prev = g->lru_prev;
+    else
+        pango_glyph_lru_tail = g->lru_prev;
+    g->lru_prev = g->lru_next = NULL;
+}
+
+static void pango_glyph_lru_push(pango_cached_glyph *g)
+{
+    g->lru_prev = NULL;
+    g->lru_next = pango_glyph_lru_head;
+    if (pango_glyph_lru_head)
+        pango_glyph_lru_head->lru_prev = g;
+    else
+        pango_glyph_lru_tail = g;
+    pango_glyph_lru_head = g;
+}
+
+static void pango_glyph_cache_remove(pango_cached_glyph *g)
+{
+    del234(pango_glyph_cache, g);
+    pango_glyph_lru_unlink(g);
+    pango_glyph_cache_bytes -= g->bytes;
+    cairo_surface_destroy(g->surface);
+    sfree(g->text);
+    sfree(g);
+}
+
+static void pango_glyph_cache_purge(struct pangofont *pfont)
+{
+    pango_cached_glyph *g, *next;
+
+    for (g = pango_glyph_lru_head; g; g = next) {
+        next = g->lru_next;
+        if (g->pfont == pfont)
+            pango_glyph_cache_remove(g);
+    }
+}
+
+/*
+ * Render one glyph into a new cache entry. 'layout' already has the
+ * right font description set up; 'areawidth' is the total width of
+ * the character cells the text will occupy.
+ */
+static pango_cached_glyph *pango_glyph_cache_render(
+    struct pangofont *pfont, PangoLayout *layout, const pango_cached_glyph *key,
+    int areawidth)
+{
+    PangoRectangle ink, logical;
+    pango_layout_set_text(layout, key->text, key->textlen);
+    pango_layout_get_pixel_extents(layout, &ink, &logical);
+
+    int w = (int)ceil(ink.width * key->scale);
+    int h = (int)ceil(ink.height * key->scale);
+    cairo_surface_t *surface = NULL;
+    bool colour = false;
+
+    if (w > 0 && h > 0) {
+        surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, w, h);
+        cairo_t *gcr = cairo_create(surface);
+        cairo_scale(gcr, key->scale, key->scale);
+        cairo_set_source_rgb(gcr, 0, 0, 0);
+        cairo_move_to(gcr, -ink.x, -ink.y);
+        pango_cairo_show_layout(gcr, layout);
+        cairo_destroy(gcr);
+        cairo_surface_flush(surface);
+
+        if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS) {
+            cairo_surface_destroy(surface);
+            return NULL;
+        }
+
+        const unsigned char *data = cairo_image_surface_get_data(surface);
+        int stride = cairo_image_surface_get_stride(surface);
+        for (int y = 0; y < h && !colour; y++) {
+            const uint32_t *row = (const uint32_t *)(data + y * stride);
+            for (int x = 0; x < w; x++) {
+                if (row[x] & 0x00FFFFFF) {
+                    colour = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    pango_cached_glyph *g = snew(pango_cached_glyph);
+    *g = *key;
+    g->text = snewn(key->textlen, char);
+    memcpy(g->text, key->text, key->textlen);
+    g->surface = surface;
+    g->colour = colour;
+    g->bytes = (size_t)w * h * 4 + sizeof(*g) + key->textlen;
+    /* Same placement as pangofont_draw_internal's uncached path */
+    g->dx = (int)floor(((areawidth - logical.width) / 2 + ink.x) *
+                       key->scale + 0.5);
+    g->dy = (int)floor(((pfont->u.height - logical.height) / 2 + ink.y) *
+                       key->scale + 0.5);
+    return g;
+}
+
+/*
+ * Draw a piece of text from the glyph cache, rendering it first if
+ * necessary. Returns false if the cache can't be used with this
+ * drawing context, in which case the caller must draw the text some
+ * other way.
+ */
+static bool pango_glyph_cache_draw(
+    unifont_drawctx *ctx, struct pangofont *pfont, PangoLayout *layout,
+    int x, int y, const char *text, size_t textlen, int areawidth,
+    int cellwidth, bool bold, bool shadowbold)
+{
+    cairo_t *cr;
+    cairo_matrix_t m;
+
+    if (ctx->type != DRAWTYPE_CAIRO)
+        return false;
+    cr = ctx->u.cairo.cr;
+
+    /*
+     * We only handle the simple case of a drawing context which is
+     * scaled equally in both directions without rotation, which is
+     * all we expect to be given.
+     */
+    cairo_get_matrix(cr, &m);
+    if (m.xy != 0 || m.yx != 0 || m.xx != m.yy || m.xx <= 0)
+        return false;
+
+    pango_cached_glyph key, *g;
+    memset(&key, 0, sizeof(key));
+    key.pfont = pfont;
+    key.bold = bold;
+    key.cellwidth = cellwidth;
+    key.scale = m.xx;
+    key.text = (char *)text;
+    key.textlen = textlen;
+
+    if (!pango_glyph_cache)
+        pango_glyph_cache = newtree234(pango_cached_glyph_cmp);
+
+    g = find234(pango_glyph_cache, &key, NULL);
+    if (g) {
+        pango_glyph_lru_unlink(g);
+    } else {
+        g = pango_glyph_cache_render(pfont, layout, &key, areawidth);
+        if (!g)
+            return false;
+        add234(pango_glyph_cache, g);
+        pango_glyph_cache_bytes += g->bytes;
+        while (pango_glyph_cache_bytes > PANGO_GLYPH_CACHE_BYTES &&
+               pango_glyph_lru_tail)
+            pango_glyph_cache_remove(pango_glyph_lru_tail);
+    }
+    pango_glyph_lru_push(g);
+
+    if (!g->surface)
+        return true;                   /* nothing visible to draw */
+
+    /*
+     * Paint the surface in device space, so that each of its pixels
+     * lands exactly on one of the target's.
+     */
+    double dx = x, dy = y;
+    cairo_user_to_device(cr, &dx, &dy);
+    dx = floor(dx + 0.5) + g->dx;
+    dy = floor(dy + 0.5) + g->dy;
+
+    cairo_save(cr);
+    cairo_identity_matrix(cr);
+    for (int i = 0; i < (shadowbold ? 2 : 1); i++) {
+        double sx = dx + i * floor(pfont->shadowoffset * key.scale + 0.5);
+        if (g->colour) {
+            cairo_set_source_surface(cr, g->surface, sx, dy);
+            cairo_paint(cr);
+        } else {
+            cairo_mask_surface(cr, g->surface, sx, dy);
+        }
+    }
+    cairo_restore(cr);
+
+    return true;
+}
 #endif
 
 static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
@@ -1603,7 +1880,7 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
     PangoRectangle rect;
     char *utfstring, *utfptr;
     size_t utflen;
-    bool shadowbold = false;
+    bool shadowbold = false, bolddesc = false;
     void (*draw_layout)(unifont_drawctx *ctx,
                         gint x, gint y, PangoLayout *layout) = NULL;
 
@@ -1634,6 +1911,7 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
                 pango_font_description_copy_static(pfont->desc);
             pango_font_description_set_weight(desc2, PANGO_WEIGHT_BOLD);
             pango_layout_set_font_description(layout, desc2);
+            bolddesc = true;
         }
     }
 
@@ -1726,6 +2004,40 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
             }
         }
 
+#ifdef DRAW_TEXT_CAIRO
+        if (combining || n == 1) {
+            /* Draw the whole piece as one glyph, if we can */
+            if (pango_glyph_cache_draw(
+                    ctx, pfont, layout, x, y, utfptr, clen, n * cellwidth,
+                    cellwidth, bolddesc, shadowbold))
+                goto drawn;
+        } else if (ctx->type == DRAWTYPE_CAIRO) {
+            /*
+             * A run of characters all of the expected width, which
+             * we can draw one cell at a time from the cache, just as
+             * Pango would have laid them out.
+             */
+            size_t pos = 0, i;
+            for (i = 0; i < n; i++) {
+                size_t start = pos++;
+                while (pos < clen && (unsigned char)utfptr[pos] >= 0x80 &&
+                       (unsigned char)utfptr[pos] < 0xC0)
+                    pos++;
+                if (!pango_glyph_cache_draw(
+                        ctx, pfont, layout, x + (int)i * cellwidth, y,
+                        utfptr + start, pos - start, cellwidth, cellwidth,
+                        bolddesc, shadowbold))
+                    break;
+            }
+            if (i == n)
+                goto drawn;
+
+            /* If the cache failed part way through (e.g. we couldn't
+             * allocate a surface), redraw the whole run the slow
+             * way. */
+        }
+#endif
+
         pango_layout_set_text(layout, utfptr, clen);
         pango_layout_get_pixel_extents(layout, NULL, &rect);
 
@@ -1737,6 +2049,9 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
                         x + (n*cellwidth - rect.width)/2 + pfont->shadowoffset,
                         y + (pfont->u.height - rect.height)/2, layout);
 
+#ifdef DRAW_TEXT_CAIRO
+      drawn:
+#endif
         utflen -= clen;
         utfptr += clen;
         string += n;
@@ -146,7 +146,7 @@ struct server_config {
     Plug listening_plug;
 };
 
-static unsigned next_id = 0;
+static unsigned next_id = 0, id_step = 1; /* unique across all workers */
 
 static void log_to_stderr(unsigned id, const char *msg)
 {
@@ -349,6 +349,8 @@ static void show_help(FILE *fp)
           "options: --listen [PORT|PATH] listen to a port on localhost, or Unix socket\n"
           "         --listen-once        (with --listen) stop after one "
           "connection\n"
+          "         --workers N          (with --listen) share connections"
+          " among N processes\n"
           "         --hostkey KEY        SSH host key (need at least one)\n"
           "         --rsakexkey KEY      key for SSH-2 RSA key exchange "
           "(in SSH-1 format)\n"
@@ -404,6 +406,7 @@ static void show_version_and_exit(void)
 const bool buildinfo_gtk_relevant = false;
 
 static bool listening = false, listen_once = false;
+static unsigned nworkers = 0;
 static bool finished = false;
 void server_instance_terminated(LogPolicy *lp)
 {
@@ -416,6 +419,22 @@ void server_instance_terminated(LogPolicy *lp)
         finished = true;
     }
 
+    /*
+     * This is called from a toplevel callback after the connection's
+     * socket has gone, so it's a safe point to report the network
+     * statistics it contributed to.
+     */
+    NetSocketStats stats;
+    net_get_stats(&stats);
+    if (stats.send_calls || stats.recv_calls) {
+        char *msg = dupprintf(
+            "network totals: %"SIZEu" sends (%"PRIu64" bytes), "
+            "%"SIZEu" recvs (%"PRIu64" bytes)", stats.send_calls,
+            stats.bytes_sent, stats.recv_calls, stats.bytes_received);
+        log_to_stderr(inst->id, msg);
+        sfree(msg);
+    }
+
     sfree(inst);
 }
 
@@ -463,7 +482,8 @@ static Plug *server_conn_plug(
 
     memset(inst, 0, sizeof(*inst));
 
-    inst->id = next_id++;
+    inst->id = next_id;
+    next_id += id_step;
     inst->ap.shared = cfg->ap_shared;
     if (cfg->ssc->stunt_allow_trivial_ki_auth)
         inst->ap.kbdint_state = 1;
@@ -688,6 +708,8 @@ int main(int argc, char **argv)
             }
         } else if (!strcmp(arg, "--listen-once")) {
             listen_once = true;
+        } else if (longoptarg(arg, "--workers", &val, &argc, &argv)) {
+            nworkers = strtoul(val, NULL, 0);
         } else if (longoptarg(arg, "--hostkey", &val, &argc, &argv)) {
             Filename *keyfile;
             int keytype;
@@ -950,6 +972,16 @@ int main(int argc, char **argv)
                     "instances\n", appname);
             exit(1);
         }
+        if (nworkers > 1 && !(ci->listen_port >= 0 || ci->listen_socket)) {
+            fprintf(stderr, "%s: cannot talk to stdio with multiple worker "
+                    "processes\n", appname);
+            exit(1);
+        }
+    }
+    if (nworkers > 1 && listen_once) {
+        fprintf(stderr, "%s: cannot listen once only with multiple worker "
+                "processes\n", appname);
+        exit(1);
     }
 
     random_ref();
@@ -966,6 +998,11 @@ int main(int argc, char **argv)
     for (size_t i = 0; i < ninstances; i++)
         cmdline_instance_start(&instances[i]);
 
+    if (nworkers > 1) {
+        next_id = server_workers_start(nworkers, appname);
+        id_step = nworkers;
+    }
+
     cli_main_loop(cliloop_no_pw_setup, cliloop_no_pw_check,
                   cliloop_always_continue, NULL);
 
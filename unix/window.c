@@ -4671,6 +4671,64 @@ void copy_all_menuitem(GtkMenuItem *item, gpointer data)
     term_copyall(inst->term, clips, lenof(clips));
 }
 
+#if GTK_CHECK_VERSION(2,0,0)
+static void save_scrollback_response(GtkDialog *dialog, gint response,
+                                     gpointer data)
+{
+    GtkFrontend *inst = (GtkFrontend *)data;
+
+    if (response == GTK_RESPONSE_ACCEPT) {
+        gchar *name = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+        FILE *fp = fopen(name, "w");
+
+        if (fp) {
+            stdio_sink sink;
+            stdio_sink_init(&sink, fp);
+            term_save_scrollback(inst->term, BinarySink_UPCAST(&sink));
+            bool err = ferror(fp);
+            int saved_errno = errno;
+            if (fclose(fp) != 0 && !err) {
+                err = true;
+                saved_errno = errno;
+            }
+            if (err)
+                nonfatal("Error writing scrollback to %s: %s",
+                         name, strerror(saved_errno));
+        } else {
+            nonfatal("Unable to open %s: %s", name, strerror(errno));
+        }
+        g_free(name);
+    }
+
+    unregister_dialog(&inst->seat, DIALOG_SLOT_SAVE_SCROLLBACK);
+    gtk_widget_destroy(GTK_WIDGET(dialog));
+}
+
+void save_scrollback_menuitem(GtkMenuItem *item, gpointer data)
+{
+    GtkFrontend *inst = (GtkFrontend *)data;
+
+    if (find_and_raise_dialog(inst, DIALOG_SLOT_SAVE_SCROLLBACK))
+        return;
+
+    GtkWidget *filechoose = gtk_file_chooser_dialog_new(
+        "Save Scrollback", GTK_WINDOW(inst->window),
+        GTK_FILE_CHOOSER_ACTION_SAVE,
+        STANDARD_CANCEL_LABEL, GTK_RESPONSE_CANCEL,
+        STANDARD_SAVE_LABEL, GTK_RESPONSE_ACCEPT,
+        (const gchar *)NULL);
+    gtk_window_set_modal(GTK_WINDOW(filechoose), true);
+#if GTK_CHECK_VERSION(2,8,0)
+    gtk_file_chooser_set_do_overwrite_confirmation(
+        GTK_FILE_CHOOSER(filechoose), true);
+#endif
+    g_signal_connect(G_OBJECT(filechoose), "response",
+                     G_CALLBACK(save_scrollback_response), inst);
+    register_dialog(&inst->seat, DIALOG_SLOT_SAVE_SCROLLBACK, filechoose);
+    gtk_widget_show(filechoose);
+}
+#endif
+
 void special_menuitem(GtkMenuItem *item, gpointer data)
 {
     GtkFrontend *inst = (GtkFrontend *)data;
@@ -5650,6 +5708,9 @@ void new_session_window(Conf *conf, const char *geometry_string)
         MKMENUITEM("Paste from " CLIPNAME_EXPLICIT_OBJECT,
                    paste_clipboard_menuitem);
         MKMENUITEM("Copy All", copy_all_menuitem);
+#if GTK_CHECK_VERSION(2,0,0)
+        MKMENUITEM("Save Scrollback...", save_scrollback_menuitem);
+#endif
         MKSEP();
         s = dupcat("About ", appname);
         MKMENUITEM(s, about_menuitem);
@@ -125,6 +125,19 @@ ptrlen bufchain_prefix(bufchain *ch)
     return make_ptrlen(ch->head->bufpos, ch->head->bufend - ch->head->bufpos);
 }
 
+/*
+ * Like bufchain_prefix, but returns up to maxn consecutive granules
+ * at once, for callers that can make use of a gather-write. Returns
+ * the number of ptrlens filled in.
+ */
+size_t bufchain_prefixes(bufchain *ch, ptrlen *out, size_t maxn)
+{
+    size_t n = 0;
+    for (struct bufchain_granule *b = ch->head; b && n < maxn; b = b->next)
+        out[n++] = make_ptrlen(b->bufpos, b->bufend - b->bufpos);
+    return n;
+}
+
 void bufchain_fetch(bufchain *ch, void *data, size_t len)
 {
     struct bufchain_granule *tmp;
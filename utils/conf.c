@@ -55,8 +55,21 @@ struct conf_entry {
 
 struct conf_tag {
     tree234 *tree;
+
+    /*
+     * Keys with no subkey are also indexed directly by their primary
+     * key, so that the mandatory accessors like conf_get_int don't
+     * have to search the tree every time. Each pointer is either
+     * NULL or points at the entry currently in the tree.
+     */
+    struct conf_entry *scalars[N_CONFIG_OPTIONS];
 };
 
+static inline bool conf_key_is_scalar(int primary)
+{
+    return conf_key_info[primary].subkey_type == CONF_TYPE_NONE;
+}
+
 /*
  * Because 'struct key' is the first element in 'struct conf_entry',
  * it's safe (guaranteed by the C standard) to cast arbitrarily back
@@ -206,6 +219,7 @@ Conf *conf_new(void)
     Conf *conf = snew(struct conf_tag);
 
     conf->tree = newtree234(conf_cmp);
+    memset(conf->scalars, 0, sizeof(conf->scalars));
 
     return conf;
 }
@@ -216,6 +230,7 @@ void conf_clear(Conf *conf)
 
     while ((entry = delpos234(conf->tree, 0)) != NULL)
         free_entry(entry);
+    memset(conf->scalars, 0, sizeof(conf->scalars));
 }
 
 void conf_free(Conf *conf)
@@ -234,6 +249,8 @@ static void conf_insert(Conf *conf, struct conf_entry *entry)
         oldentry = add234(conf->tree, entry);
         assert(oldentry == entry);
     }
+    if (conf_key_is_scalar(entry->key.primary))
+        conf->scalars[entry->key.primary] = entry;
 }
 
 void conf_copy_into(Conf *newconf, Conf *oldconf)
@@ -249,6 +266,8 @@ void conf_copy_into(Conf *newconf, Conf *oldconf)
         copy_value(&entry2->value, &entry->value,
                    conf_key_info[entry->key.primary].value_type);
         add234(newconf->tree, entry2);
+        if (conf_key_is_scalar(entry2->key.primary))
+            newconf->scalars[entry2->key.primary] = entry2;
     }
 }
 
@@ -263,26 +282,22 @@ Conf *conf_copy(Conf *oldconf)
 
 bool conf_get_bool(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_BOOL);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.boolval;
 }
 
 int conf_get_int(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_INT);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.intval;
 }
@@ -303,41 +318,35 @@ int conf_get_int_int(Conf *conf, int primary, int secondary)
 
 char *conf_get_str(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_STR);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.stringval.str;
 }
 
 char *conf_get_utf8(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_UTF8);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.stringval.str;
 }
 
 char *conf_get_str_ambi(Conf *conf, int primary, bool *utf8)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_STR ||
            conf_key_info[primary].value_type == CONF_TYPE_UTF8 ||
            conf_key_info[primary].value_type == CONF_TYPE_STR_AMBI);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     if (utf8)
         *utf8 = entry->value.u.stringval.utf8;
@@ -408,26 +417,22 @@ char *conf_get_str_nthstrkey(Conf *conf, int primary, int n)
 
 Filename *conf_get_filename(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_FILENAME);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.fileval;
 }
 
 FontSpec *conf_get_fontspec(Conf *conf, int primary)
 {
-    struct key key;
     struct conf_entry *entry;
 
     assert(conf_key_info[primary].subkey_type == CONF_TYPE_NONE);
     assert(conf_key_info[primary].value_type == CONF_TYPE_FONT);
-    key.primary = primary;
-    entry = find234(conf->tree, &key, NULL);
+    entry = conf->scalars[primary];
     assert(entry);
     return entry->value.u.fontval;
 }
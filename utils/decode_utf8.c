@@ -148,6 +148,36 @@ bool dotest(const char *file, int line, const char *input, size_t ninput,
         return false;
     }
 
+    /*
+     * Now decode the same input using decode_utf8_run, falling back
+     * to decode_utf8 wherever it stops, and check we get the same
+     * characters. Use a small output buffer so that we also test
+     * stopping because the output is full.
+     */
+    const char *p = input;
+    size_t len = ninput;
+    noutput = 0;
+    while (len > 0) {
+        unsigned wcs[3];
+        size_t n = decode_utf8_run(&p, &len, wcs, lenof(wcs));
+
+        if (n < lenof(wcs) && len > 0) {
+            BinarySource_BARE_INIT(src, p, len);
+            wcs[n++] = decode_utf8(src, NULL);
+            p += src->pos;
+            len -= src->pos;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (noutput >= nchars || chars[noutput] != wcs[i]) {
+                printf("%s:%d: FAIL: decode_utf8_run gave U-%08x\n",
+                       file, line, wcs[i]);
+                return false;
+            }
+            noutput += (wcs[i] == 0xFFFD ? 2 : 1);
+        }
+    }
+
     printf("%s:%d: pass\n", file, line);
     return true;
 }
@@ -252,6 +282,19 @@ int main(void)
     DOTEST("\xF8\x80\x80\x80\x80", 0xFFFD, DUTF8_OVERLONG_ENCODING);
     DOTEST("\xFC\x80\x80\x80\x80\x80", 0xFFFD, DUTF8_OVERLONG_ENCODING);
 
+    /* Long enough runs of ASCII to be handled a word at a time, and
+     * interrupted in various places */
+    DOTEST("abcdefghijklmnopqrstuvwxyz",
+           'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+           'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z');
+    DOTEST("abcdefg\xCE\xBAhijklmnop\x80qrstuvwxyz",
+           'a', 'b', 'c', 'd', 'e', 'f', 'g', 0x03BA, 'h', 'i', 'j', 'k',
+           'l', 'm', 'n', 'o', 'p', 0xFFFD, DUTF8_SPURIOUS_CONTINUATION,
+           'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z');
+    DOTEST("\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80" "abcdefgh\xEF\xBF\xBE",
+           0x4E2D, 0x6587, 0x1F600,
+           'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0xFFFE);
+
     printf("%d tests %d passed", ntest, npass);
     if (npass < ntest) {
         printf(" %d FAILED\n", ntest-npass);
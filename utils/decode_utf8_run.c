@@ -0,0 +1,95 @@
+/*
+ * Decode a run of well-formed UTF-8 in bulk.
+ *
+ * This is the fast path for code that decodes a lot of UTF-8 at once.
+ * It deals only with input that is entirely valid, and stops as soon
+ * as it sees anything else, leaving the caller to fall back to its
+ * usual character-at-a-time decoder for the awkward part. That way
+ * the fallback decoder decides how to handle and report errors, and
+ * this function doesn't have to duplicate any of that policy.
+ */
+
+#include <string.h>
+
+#include "misc.h"
+
+#define ASCII_WORD_MASK 0x8080808080808080ULL
+
+size_t decode_utf8_run(const char **input, size_t *inlen,
+                       unsigned *out, size_t outlen)
+{
+    const unsigned char *p = (const unsigned char *)*input;
+    const unsigned char *end = p + *inlen;
+    size_t n = 0;
+
+    while (n < outlen && p < end) {
+        unsigned c = p[0], wc;
+        size_t avail = end - p;
+
+        if (c < 0x80) {
+            /*
+             * Runs of ASCII are common even in text that isn't
+             * mostly ASCII, so check 8 bytes at a time for any with
+             * the top bit set, and copy them across if there are
+             * none.
+             */
+            while (avail >= 8 && outlen - n >= 8) {
+                uint64_t word;
+                memcpy(&word, p, 8);
+                if (word & ASCII_WORD_MASK)
+                    break;
+                for (size_t i = 0; i < 8; i++)
+                    out[n+i] = p[i];
+                p += 8;
+                n += 8;
+                avail -= 8;
+            }
+            if (avail > 0 && *p < 0x80 && n < outlen)
+                out[n++] = *p++;
+            continue;
+        }
+
+        if (c < 0xC2) {
+            /* A stray continuation byte, or the start of an
+             * overlong two-byte encoding */
+            break;
+        } else if (c < 0xE0) {
+            if (avail < 2 || (p[1] & 0xC0) != 0x80)
+                break;
+            wc = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+            p += 2;
+        } else if (c < 0xF0) {
+            if (avail < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80)
+                break;
+            wc = ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+
+            /*
+             * Leave the noncharacters U+FFFE and U+FFFF to the
+             * fallback as well as surrogates and overlong encodings,
+             * because some of our callers treat them as errors.
+             */
+            if (wc < 0x800 || (wc >= 0xD800 && wc < 0xE000) || wc >= 0xFFFE)
+                break;
+            p += 3;
+        } else if (c < 0xF5) {
+            if (avail < 4 || (p[1] & 0xC0) != 0x80 ||
+                (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80)
+                break;
+            wc = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) |
+                ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+            if (wc < 0x10000 || wc > 0x10FFFF)
+                break;
+            p += 4;
+        } else {
+            /* Lead bytes for code points beyond U+10FFFF, or not
+             * legal in UTF-8 at all */
+            break;
+        }
+
+        out[n++] = wc;
+    }
+
+    *inlen -= p - (const unsigned char *)*input;
+    *input = (const char *)p;
+    return n;
+}
@@ -8,23 +8,48 @@ wchar_t *decode_utf8_to_wide_string(const char *s)
 {
     wchar_t *ws = NULL;
     size_t wlen = 0, wsize = 0;
+    size_t len = strlen(s);
 
-    BinarySource src[1];
-    BinarySource_BARE_INIT_PL(src, ptrlen_from_asciz(s));
-
-    while (get_avail(src) > 0) {
+    while (len > 0) {
         /*
-         * decode_utf8_to_wchar might emit up to 2 wchar_t if wchar_t
-         * is 16 bits (because of UTF-16 surrogates), but will emit at
-         * most one if wchar_t is 32-bit
+         * Decode as much well-formed UTF-8 as we can in bulk. Each
+         * code point might need 2 wchar_t if wchar_t is 16 bits
+         * (because of UTF-16 surrogates), but needs only one if
+         * wchar_t is 32-bit.
          */
-        sgrowarrayn(ws, wsize, wlen, 1 + (sizeof(wchar_t) < 4));
+        unsigned cps[256];
+        size_t ncps = decode_utf8_run(&s, &len, cps, lenof(cps));
+        sgrowarrayn(ws, wsize, wlen,
+                    (ncps + 1) * (1 + (sizeof(wchar_t) < 4)));
+
+        for (size_t i = 0; i < ncps; i++) {
+            unsigned wc = cps[i];
+            if (sizeof(wchar_t) > 2 || wc < 0x10000) {
+                ws[wlen++] = wc;
+            } else {
+                unsigned wcoff = wc - 0x10000;
+                ws[wlen++] = 0xD800 | (0x3FF & (wcoff >> 10));
+                ws[wlen++] = 0xDC00 | (0x3FF & wcoff);
+            }
+        }
 
-        /* We ignore 'err': if it is set, then the character decode
-         * function will have emitted U+FFFD REPLACEMENT CHARACTER,
-         * which is what we'd have done in response anyway. */
-        DecodeUTF8Failure err;
-        wlen += decode_utf8_to_wchar(src, ws + wlen, &err);
+        if (len > 0 && ncps < lenof(cps)) {
+            /*
+             * Something decode_utf8_run wouldn't handle. Pass one
+             * character of it to the general decoder.
+             *
+             * We ignore 'err': if it is set, then the character
+             * decode function will have emitted U+FFFD REPLACEMENT
+             * CHARACTER, which is what we'd have done in response
+             * anyway.
+             */
+            BinarySource src[1];
+            BinarySource_BARE_INIT(src, s, len);
+            DecodeUTF8Failure err;
+            wlen += decode_utf8_to_wchar(src, ws + wlen, &err);
+            s += src->pos;
+            len -= src->pos;
+        }
     }
 
     /* Reallocate to the final size and append the trailing NUL */
@@ -54,28 +54,8 @@ enum {
 
 static cclass_t combining_class(uchar c)
 {
-    struct range {
-        uchar start, end;
-        cclass_t cclass;
-    };
-    static const struct range ranges[] = {
-        #include "unicode/combining_classes.h"
-    };
-
-    const struct range *start = ranges, *end = start + lenof(ranges);
-
-    while (end > start) {
-        const struct range *curr = start + (end-start) / 2;
-        if (c < curr->start)
-            end = curr;
-        else if (c > curr->end)
-            start = curr + 1;
-        else
-            return curr->cclass;
-    }
-
-    return 0;
-};
+    return unicode_props(c)->cclass;
+}
 
 static unsigned decompose_char(uchar c, uchar *out)
 {
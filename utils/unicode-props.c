@@ -0,0 +1,23 @@
+/*
+ * Look up the properties of a Unicode character that the terminal
+ * and the normalisation code need on every glyph, in the three-stage
+ * table generated by unicode/read_ucd.py.
+ */
+
+#include "putty.h"
+#include "bidi.h"
+
+#include "unicode/char_props.h"
+
+const UnicodeProps *unicode_props(unsigned c)
+{
+    if (c >= UNICODE_PROPS_LIMIT)
+        return &unicode_props_records[0];
+
+    unsigned middle = unicode_props_top[c >> UNICODE_PROPS_SHIFT1];
+    unsigned leaf = unicode_props_middle[middle][
+        (c >> UNICODE_PROPS_SHIFT2) &
+        ((1 << (UNICODE_PROPS_SHIFT1 - UNICODE_PROPS_SHIFT2)) - 1)];
+    return &unicode_props_records[unicode_props_leaf[leaf][
+        c & ((1 << UNICODE_PROPS_SHIFT2) - 1)]];
+}
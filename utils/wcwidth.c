@@ -63,32 +63,6 @@
 
 #include "putty.h" /* for prototypes */
 
-struct interval {
-  unsigned int first;
-  unsigned int last;
-};
-
-/* auxiliary function for binary search in interval table */
-static bool bisearch(unsigned int ucs, const struct interval *table, int max) {
-  int min = 0;
-  int mid;
-
-  if (ucs < table[0].first || ucs > table[max].last)
-    return false;
-  while (max >= min) {
-    mid = (min + max) / 2;
-    if (ucs > table[mid].last)
-      min = mid + 1;
-    else if (ucs < table[mid].first)
-      max = mid - 1;
-    else
-      return true;
-  }
-
-  return false;
-}
-
-
 /* The following two functions define the column width of an ISO 10646
  * character as follows:
  *
@@ -123,15 +97,7 @@ static bool bisearch(unsigned int ucs, const struct interval *table, int max) {
 
 int mk_wcwidth(unsigned int ucs)
 {
-  /* sorted list of non-overlapping intervals of non-spacing characters */
-  static const struct interval combining[] = {
-    #include "unicode/nonspacing_chars.h"
-  };
-
-  /* A sorted list of intervals of double-width characters */
-  static const struct interval wide[] = {
-    #include "unicode/wide_chars.h"
-  };
+  const UnicodeProps *props;
 
   /* test for 8-bit control characters */
   if (ucs == 0)
@@ -139,16 +105,16 @@ int mk_wcwidth(unsigned int ucs)
   if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0))
     return -1;
 
-  /* binary search in table of non-spacing characters */
-  if (bisearch(ucs, combining,
-               sizeof(combining) / sizeof(struct interval) - 1))
+  props = unicode_props(ucs);
+
+  /* non-spacing characters */
+  if (props->flags & UPROP_NONSPACING)
     return 0;
 
   /* if we arrive here, ucs is not a combining or C0/C1 control character */
 
-  /* binary search in table of double-width characters */
-  if (bisearch(ucs, wide,
-           sizeof(wide) / sizeof(struct interval) - 1))
+  /* double-width characters */
+  if (props->flags & UPROP_WIDE)
     return 2;
 
   /* normal width character */
@@ -181,14 +147,8 @@ int mk_wcswidth(const unsigned int *pwcs, size_t n)
  */
 int mk_wcwidth_cjk(unsigned int ucs)
 {
-  /* A sorted list of intervals of ambiguous width characters */
-  static const struct interval ambiguous[] = {
-    #include "unicode/ambiguous_wide_chars.h"
-  };
-
-  /* binary search in table of non-spacing characters */
-  if (bisearch(ucs, ambiguous,
-               sizeof(ambiguous) / sizeof(struct interval) - 1))
+  /* ambiguous width characters */
+  if (unicode_props(ucs)->flags & UPROP_AMBIGUOUS)
     return 2;
 
   return mk_wcwidth(ucs);
@@ -113,6 +113,7 @@ typedef const char *HelpCtx;
 #define WINHELP_CTX_ssh_hk_known "config-ssh-prefer-known-hostkeys"
 #define WINHELP_CTX_ssh_gssapi_kex_delegation "config-ssh-kex-gssapi-delegation"
 #define WINHELP_CTX_ssh_kex_repeat "config-ssh-kex-rekey"
+#define WINHELP_CTX_ssh_max_window "config-ssh-max-window"
 #define WINHELP_CTX_ssh_kex_manual_hostkeys "config-ssh-kex-manual-hostkeys"
 #define WINHELP_CTX_ssh_kex_cert "config-ssh-kex-cert"
 #define WINHELP_CTX_ssh_cert_valid_expr "config-ssh-cert-valid-expr"